@@ -0,0 +1,56 @@
+#ifndef CYCOM_DISPLAY_BAKED_FONT_H_
+#define CYCOM_DISPLAY_BAKED_FONT_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ui {
+
+/**
+ * @brief ビルド時にビットマップ化して組み込んだグリフ
+ * 
+ * 8bitαのビットマップ（1行 = width バイト）と配置情報は FreeType の FT_LOAD_RENDER と同じ値。
+ */
+struct BakedGlyph {
+    uint32_t codepoint;
+    int16_t width, height;
+    int16_t left, top;       // bitmap_left/top
+    int16_t advance;         // ピクセル
+    uint32_t index;          // フォント内のグリフ番号（カーニング用）
+    const uint8_t* alpha;    // 空グリフは nullptr
+};
+
+/**
+ * @brief 1つのフォント・サイズぶんの組み込みグリフ表（codepoint 昇順）
+ */
+struct BakedFont {
+    const char* family;      // FreeType の family_name
+    const char* style;       // FreeType の style_name
+    int size_px;
+    const BakedGlyph* glyphs;
+    size_t count;
+
+    /**
+     * @brief コードポイントに対応するグリフを探す
+     * 
+     * @return const BakedGlyph* 見つからなければ nullptr
+     */
+    const BakedGlyph* Find(uint32_t cp) const;
+};
+
+/**
+ * @brief 組み込みグリフ表を探す
+ * 
+ * 組み込み表は cycom_font_bake がビルド時に生成する（CYCOM_BAKED_FONT_* で対象を指定）。
+ * 実行時のフォントと同じフォントから生成した表だけを使うため、family / style も一致を確認する。
+ * 
+ * @param family フォントのファミリー名
+ * @param style フォントのスタイル名
+ * @param size_px ピクセルサイズ
+ * @return const BakedFont* 見つからなければ nullptr
+ */
+const BakedFont* FindBakedFont(const char* family, const char* style, int size_px);
+
+}  // namespace ui
+
+#endif  // CYCOM_DISPLAY_BAKED_FONT_H_
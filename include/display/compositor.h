@@ -0,0 +1,97 @@
+#ifndef CYCOM_DISPLAY_COMPOSITOR_H_
+#define CYCOM_DISPLAY_COMPOSITOR_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "display/framebuffer.h"
+#include "display/rect.h"
+#include "display/surface.h"
+
+namespace display {
+
+/**
+ * @brief 静的な背景レイヤと動的な描画を合成するクラス
+ * 
+ * 背景画像は一度だけデコードしてRGB565の静的レイヤとして保持する。
+ * テキストやウィジェットを描き直す際は、その領域だけを静的レイヤからキャンバスへ復元し、
+ * その上に合成する。領域の復元は矩形コピーだけで済み、JPEGの再デコードは発生しない。
+ */
+class Compositor {
+public:
+    /**
+     * @brief 合成先のキャンバスを指定して初期化する（背景は白）
+     * 
+     * @param canvas 合成先（静的レイヤはこのサイズで確保する）
+     */
+    explicit Compositor(Framebuffer& canvas);
+
+    /**
+     * @brief 画像をデコードして静的レイヤに設定する
+     * 
+     * @param path 画像ファイルのパス
+     * @return true 成功
+     * @return false 読み込み失敗（静的レイヤは変更しない）
+     */
+    bool SetBackgroundImage(const std::string& path);
+
+    /**
+     * @brief パネル転送順のRGB565画像（アセットパック等）を静的レイヤに設定する
+     * 
+     * @param panel_px キャンバスと同じサイズのピクセル列（コピーするため以後は不要）
+     */
+    void SetBackgroundPanelPixels(const uint16_t* panel_px);
+
+    /**
+     * @brief ホスト順のRGB565画像（描画済みのページ等）を静的レイヤに設定する
+     * 
+     * 以前の静的レイヤを保存したものを戻す場合は、保存時の版（Layer().version）を渡す。
+     * 内容が同じなら版も同じになり、版をキーにした描画結果のキャッシュが引き続き使える。
+     * 
+     * @param px キャンバスと同じサイズのピクセル列（コピーするため以後は不要）
+     * @param version px を保存したときの静的レイヤの版（0 なら新しい版を割り当てる）
+     */
+    void SetBackgroundPixels(const uint16_t* px, uint64_t version = 0);
+
+    /**
+     * @brief キャンバスの現在の内容を静的レイヤにする
+     * 
+     * 背景の上に固定表示（単位・見出し等）を描いた後に呼ぶと、以後はそれらも背景として復元される。
+     */
+    void CaptureCanvas();
+
+    /**
+     * @brief 静的レイヤを単色にする
+     * 
+     * @param rgb565 背景色
+     */
+    void SetBackgroundColor(uint16_t rgb565);
+
+    /**
+     * @brief 指定領域を静的レイヤからキャンバスへ復元する
+     * 
+     * @param r 復元する領域（画面外は切り取られる）
+     */
+    void Restore(const Rect& r);
+
+    /**
+     * @brief 画面全体を静的レイヤで塗り直す
+     */
+    void RestoreAll();
+
+    /**
+     * @brief 静的レイヤへの参照を取得する
+     */
+    SurfaceView Layer() const;
+
+private:
+    Framebuffer& canvas_;
+    std::vector<uint16_t> layer_;
+    uint64_t version_ = 0;       // 静的レイヤの内容の版
+    uint64_t last_version_ = 0;  // 割り当て済みの最大の版（背景を設定するたびに進める）
+};
+
+}  // namespace display
+
+#endif  // CYCOM_DISPLAY_COMPOSITOR_H_
@@ -2,10 +2,23 @@
 #define DISPLAY_DISPLAY_MANAGER_H
 
 #include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
 #include <thread>
+#include <utility>
+#include <vector>
 #include "driver/interface/i_display.h"
+#include "display/compositor.h"
+#include "display/flush_manager.h"
+#include "display/page_cache.h"
 #include "display/text_renderer.h"
+#include "display/widget/animation.h"
+#include "display/widget/widget.h"
 #include "sensor/gps/gps_l76k.h"
+#include "util/asset_pack.h"
+#include "util/update_notifier.h"
 
 namespace display {
 
@@ -13,17 +26,33 @@ namespace display {
  * @brief ディスプレイ更新を管理するクラス（Touch / Logger / SensorManager と同じパターン）
  * 
  * コンストラクタでディスプレイ更新スレッドを自動起動し、デストラクタで安全に停止する。
- * 1秒周期でGPSデータを取得し、LCD画面に速度を表示する。
+ * 新しいGNSSエポック・走行統計・タッチの更新通知で起床し、LCD画面に速度等を表示する。
+ * 描画頻度は最大フレームレートで制限し、通知がない間も一定周期（ハートビート）で再評価する。
+ * 描画はバックバッファへ行い、パネルへの転送は FlushManager の転送スレッドが非同期に行う。
+ * 
+ * 画面は複数のページ（速度・速度メーター・高度・位置・測位状態）からなり、スワイプで切り替える。
+ * 各ページの静的部分（背景と見出し・単位）は初回に一度だけ描いて PageCache に保持し、
+ * 切り替えは全画面1回の転送と値の描画だけで済ませる。
+ *
+ * メーターの指針などアニメーション中のウィジェットがある間は、max_fps によらず
+ * animation_fps の周期で描き、各フレームでは動いた部分の領域だけを転送する。
  */
 class DisplayManager {
 public:
     /**
      * @brief DisplayManager を初期化し、ディスプレイ更新スレッドを自動起動する
      * 
+     * @param config_path 設定ファイルのパス（display.max_fps / idle_heartbeat_ms / asset_pack /
+     *                    font_atlas / glyph_mode / glyph_cache_kb / rendered_glyph_cache_kb /
+     *                    label_cache_kb / pixel_format / frame_pacing / page_cache_kb /
+     *                    page_cache_policy / page_spill_dir / page_spill_kb /
+     *                    animation_fps / tween_ms）
      * @param lcd LCD ディスプレイへの参照
      * @param gps GPS データソースへの参照
+     * @param notifier 更新通知の受け口（GPS・タッチ等の通知先と同じものを渡す）
      */
-    DisplayManager(driver::IDisplay& lcd, sensor::L76k& gps);
+    DisplayManager(const std::string& config_path, driver::IDisplay& lcd, sensor::L76k& gps,
+                   util::UpdateNotifier& notifier);
 
     /**
      * @brief ディスプレイ更新スレッドを安全に停止させる
@@ -31,22 +60,152 @@ public:
     ~DisplayManager();
 
 private:
+    struct Config {
+        int max_fps = 10;
+        int idle_heartbeat_ms = 1000;
+        std::string asset_pack_path;
+        std::string font_atlas_path;
+        ui::GlyphMode glyph_mode = ui::GlyphMode::kBitmap;
+        size_t glyph_cache_bytes = ui::TextRenderer::kDefaultAlphaCacheBytes;
+        size_t rendered_glyph_cache_bytes = ui::TextRenderer::kDefaultRenderedCacheBytes;
+        size_t label_cache_bytes = ui::TextRenderer::kDefaultLabelCacheBytes;
+        driver::PixelFormat pixel_format = driver::PixelFormat::kRGB565;
+        FramePacing frame_pacing = FramePacing::kTearFree;
+        PageCache::Config page_cache;
+        int animation_fps = 30;
+        std::chrono::milliseconds tween{1000};
+    };
+
+    /**
+     * @brief 1画面分のウィジェット
+     */
+    struct Page {
+        std::string background;        // 背景画像名（resource/background/ 以下）
+        ui::WidgetTree static_widgets;  // 表示内容が変わらないもの（静的部分としてキャッシュする）
+        ui::WidgetTree widgets;         // 値に応じて描き直すもの
+        uint64_t layer_version = 0;     // キャッシュした静的部分の背景レイヤの版
+    };
+
+    /**
+     * @brief 設定ファイルの display セクションを読み込む
+     */
+    static Config LoadConfig(const std::string& config_path);
+
+    /**
+     * @brief フォントの読み込み元を決める（アセットパックにあればマップ済みデータを使う）
+     */
+    static ui::FontSource SelectFont(const util::AssetPack& assets);
+
+    /**
+     * @brief 背景画像を表示する（アセットパックにあればデコードなしでそのまま転送）
+     * 
+     * @param name 画像名（resource/background/ 以下のファイル名）
+     * @return true 成功
+     * @return false 画像が見つからない
+     */
+    bool ShowBackground(const std::string& name);
+
+    /**
+     * @brief 背景画像を静的レイヤに読み込む（アセットパックにあればデコードしない）
+     * 
+     * @param name 画像名（resource/background/ 以下のファイル名）
+     * @return true 成功
+     * @return false 画像が見つからない（静的レイヤは変更しない）
+     */
+    bool LoadBackgroundLayer(const std::string& name);
+
+    /**
+     * @brief ページを切り替える（転送は次の Present() で行う）
+     * 
+     * 静的部分がキャッシュにあればそれを背景レイヤにし、なければ背景と固定表示を描いて
+     * キャッシュに保存する。
+     * 
+     * @param index ページ番号
+     */
+    void ShowPage(size_t index);
+
     void Start();
     void Stop();
     
     /**
-     * @brief 初期画面を表示する（起動画面 → 計測画面）
+     * @brief 初期画面を表示する（起動画面 → 最初のページ）
      */
     void ShowInitialScreens();
     
     /**
-     * @brief ディスプレイ更新ループ（1秒周期でGPS速度を画面表示）
+     * @brief 全ページのウィジェットを構築する
+     */
+    void BuildPages();
+
+    /**
+     * @brief 大きな数値1つと単位・推移チャートからなるページを作る
+     * 
+     * @param title 見出し（空なら時刻を表示する）
+     * @param source 表示・記録する値
+     * @param decimals 小数点以下の桁数
+     * @param placeholder 値が無効なときの表示
+     * @param unit 単位
+     * @param chart_max チャートの上端の値（下端は0）
+     */
+    Page BuildValuePage(const std::string& title, const std::function<double()>& source,
+                        int decimals, const std::string& placeholder, const std::string& unit,
+                        double chart_max);
+
+    /**
+     * @brief 見出しと指針式メーター・数値・単位からなるページを作る
+     * 
+     * @param title 見出し
+     * @param source 表示する値
+     * @param decimals 小数点以下の桁数
+     * @param placeholder 値が無効なときの表示
+     * @param unit 単位
+     * @param gauge_max メーターの最大値（最小値は0）
+     */
+    Page BuildGaugePage(const std::string& title, const std::function<double()>& source,
+                        int decimals, const std::string& placeholder, const std::string& unit,
+                        double gauge_max);
+
+    /**
+     * @brief ページの右上に測位状態のアイコンを置く（見出しが固定表示のページ用）
+     */
+    void AddStatusIcon(Page& page);
+
+    // 行の値の表示領域から値のウィジェットを作る関数
+    using RowFactory = std::function<std::unique_ptr<ui::Widget>(const Rect&)>;
+
+    /**
+     * @brief 見出しと「項目名・値」の行からなるページを作る
+     * 
+     * @param title 見出し
+     * @param rows 項目名と値のウィジェットを作る関数の組
+     */
+    Page BuildTablePage(const std::string& title,
+                        const std::vector<std::pair<std::string, RowFactory>>& rows);
+
+    /**
+     * @brief ディスプレイ更新ループ（更新通知で起床し、値が変わったウィジェットだけを描き直す）
+     * 
+     * アニメーション中のウィジェットがある間は通知を待たず、animator_ が決める時刻ごとに描く。
      */
     void DisplayLoop();
 
+    // 起動から最初のフレーム表示までの計測起点（最初に初期化されるよう先頭に置く）
+    std::chrono::steady_clock::time_point boot_start_;
     driver::IDisplay& lcd_;
     sensor::L76k& gps_;
-    ui::TextRenderer tr_;
+    util::UpdateNotifier& notifier_;
+    Config config_;
+    util::AssetPack assets_;  // フォント・背景のパック（mmap、tr_ より先に初期化）
+    ui::GlyphAtlas atlas_;    // 事前ラスタライズ済みグリフ（mmap、tr_ より長く生存する）
+    std::chrono::milliseconds min_frame_interval_{100};  // 1 / max_fps
+    std::chrono::milliseconds idle_heartbeat_{1000};
+    FlushManager flush_;
+    Compositor compositor_;  // 表示中のページの静的レイヤ
+    PageCache page_cache_;   // 各ページの静的部分（compositor_ の静的レイヤと同じ形式）
+    ui::TextRenderer tr_;  // flush_ のバックバッファへ描画する
+    ui::AnimationScheduler animator_;  // アニメーション中のフレーム時刻（Display スレッド専有）
+    std::vector<Page> pages_;
+    size_t current_page_ = 0;
     
     std::thread th_;
     std::atomic<bool> running_{false};
@@ -0,0 +1,192 @@
+#ifndef CYCOM_DISPLAY_FLUSH_MANAGER_H_
+#define CYCOM_DISPLAY_FLUSH_MANAGER_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "display/framebuffer.h"
+#include "display/rect.h"
+#include "driver/interface/i_display.h"
+
+namespace display {
+
+/**
+ * @brief 転送を始めるタイミング
+ */
+enum class FramePacing {
+    kLowLatency,  // Present() の直後に送る（遅延が最小。走査と交差するとティアリングが出る）
+    kTearFree,    // パネルの垂直ブランキングの開始を待ってから送る（最大1走査周期の遅延）
+};
+
+/**
+ * @brief パネル転送の統計
+ */
+struct FlushStats {
+    uint64_t frames = 0;  // 送ったフレーム数
+    uint64_t bytes = 0;   // 送ったピクセルデータの合計バイト数（コマンド・アドレスは含まない）
+    size_t last_frame_bytes = 0;
+    std::chrono::microseconds last_frame_time{0};  // 直近フレームの転送時間（TE 待ちは含まない）
+    std::chrono::microseconds max_frame_time{0};
+};
+
+/**
+ * @brief ダブルバッファでパネル転送を非同期に行うクラス（Touch / Logger と同じパターン）
+ * 
+ * 描画側は Canvas()（バックバッファ）へ描き、Present() でフロントバッファと入れ替える。
+ * 入れ替えはピクセル配列のポインタ交換のみで、フレーム全体のコピーは発生しない。
+ * コンストラクタで転送スレッドを自動起動し、フロントバッファのダーティ矩形だけを
+ * SPI でパネルへ送る。転送中も描画側は次のフレームを組み立てられる。
+ */
+class FlushManager {
+public:
+    /**
+     * @brief FlushManager を初期化し、転送スレッドを自動起動する
+     * 
+     * @param panel 転送先のパネル
+     */
+    explicit FlushManager(driver::IDisplay& panel);
+
+    /**
+     * @brief 転送スレッドを安全に停止させる（転送中のフレームは送り切る）
+     */
+    ~FlushManager();
+
+    /**
+     * @brief 描画先のバックバッファを取得する（描画スレッドからのみ使用すること）
+     */
+    Framebuffer& Canvas() { return canvas_; }
+
+    /**
+     * @brief バックバッファの内容を確定し、転送スレッドへ渡す
+     * 
+     * 前のフレームの転送が終わっていなければ、終わるまで待つ（転送待ちは最大1フレーム）。
+     * ダーティ領域がなければ何もしない。
+     */
+    void Present();
+
+    /**
+     * @brief パネル転送順の全画面画像を、変換なしでそのままパネルへ送る
+     * 
+     * アセットパックの画像など、パネル形式で用意済みのフレーム向け。
+     * バックバッファとフロントバッファにも同じ内容を反映するため、以後の差分更新と整合する。
+     * 未確定のダーティ領域は破棄される。
+     * 
+     * @param panel_px キャンバスと同じサイズのピクセル列（転送完了まで有効であること）
+     */
+    void PresentFrame(const uint16_t* panel_px);
+
+    /**
+     * @brief 転送中のフレームが送り終わるまで待つ
+     */
+    void WaitIdle();
+
+    /**
+     * @brief パネルへの転送形式を変更する（描画スレッドからのみ使用すること）
+     * 
+     * 次の Present() で、そのフレームのダーティ矩形を送る前にパネルへ反映する。
+     * キャンバスは形式によらず RGB565 のまま。
+     * 
+     * @param format ピクセル形式
+     */
+    void SetPixelFormat(driver::PixelFormat format);
+
+    /**
+     * @brief 転送を始めるタイミングを変更する（次のフレームから反映）
+     * 
+     * kTearFree でもパネルが垂直ブランキングを検出できない場合や、TE 信号が来ない場合は
+     * 待たずに送る。
+     * 
+     * @param pacing 転送タイミング
+     */
+    void SetFramePacing(FramePacing pacing) {
+        pacing_.store(pacing, std::memory_order_relaxed);
+    }
+    FramePacing GetFramePacing() const { return pacing_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief パネルがハードウェア縦スクロールに対応しているか
+     */
+    bool SupportsHardwareScroll() const { return panel_.SupportsHardwareScroll(); }
+
+    /**
+     * @brief ハードウェアスクロールの方向（画面の向きによって行単位か列単位かが変わる）
+     */
+    driver::ScrollAxis GetScrollAxis() const { return panel_.GetScrollAxis(); }
+
+    /**
+     * @brief スクロールの領域と開始ラインを設定する（描画スレッドからのみ使用すること）
+     * 
+     * 次の Present() で、そのフレームのダーティ矩形を送り終えた後にパネルへ反映する。
+     * 新しく描いたラインが表示位置に来るのは、そのラインの転送後になる。
+     * 
+     * @param top スクロール領域の先頭ライン
+     * @param height スクロール領域のライン数
+     * @param start 領域の先頭に表示するメモリ上のライン
+     */
+    void SetScroll(int top, int height, int start);
+
+    /**
+     * @brief 転送の統計を取得する（どのスレッドからでも可）
+     */
+    FlushStats GetStats() const;
+
+private:
+    void Start();
+    void Stop();
+
+    /**
+     * @brief 転送ループ（Present() で渡されたダーティ矩形をパネルへ送る）
+     */
+    void FlushLoop();
+
+    /**
+     * @brief 垂直ブランキングの開始を待つ（転送スレッドから呼ぶ）
+     * 
+     * TE 信号が続けて来なければ未接続とみなし、以後は待たない。
+     */
+    void WaitForVBlank();
+
+    driver::IDisplay& panel_;
+    Framebuffer canvas_;                // バックバッファ（描画スレッド専有）
+    std::vector<uint16_t> front_;       // フロントバッファ（転送中は転送スレッドが読む）
+    std::vector<Rect> pending_;         // front_ のうち転送すべき領域
+    std::vector<Rect> frame_dirty_;     // Present() 用の作業領域
+    const uint16_t* direct_frame_ = nullptr;  // PresentFrame() で渡された転送待ちの画像
+
+    // スクロール設定（requested は描画スレッド専有、pending は Present() で渡した分）
+    struct Scroll {
+        int top = 0, height = 0, start = 0;
+        bool set = false;
+    };
+    Scroll scroll_requested_;
+    Scroll scroll_pending_;
+    // 転送形式の変更（同上）
+    struct FormatChange {
+        driver::PixelFormat format = driver::PixelFormat::kRGB565;
+        bool set = false;
+    };
+    FormatChange format_requested_;
+    FormatChange format_pending_;
+
+    std::atomic<FramePacing> pacing_{FramePacing::kLowLatency};
+    int vblank_misses_ = 0;     // 連続して TE を検出できなかった回数（転送スレッド専有）
+    bool vblank_lost_ = false;  // TE が来ないため待機をやめた（同上）
+    driver::PixelFormat format_ = driver::PixelFormat::kRGB565;  // パネルの転送形式（同上）
+
+    mutable std::mutex mtx_;
+    std::condition_variable cv_;
+    bool busy_ = false;  // pending_ が転送待ち/転送中
+    FlushStats stats_;   // mtx_ で保護
+
+    std::thread th_;
+    std::atomic<bool> running_{false};
+};
+
+}  // namespace display
+
+#endif  // CYCOM_DISPLAY_FLUSH_MANAGER_H_
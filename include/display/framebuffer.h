@@ -0,0 +1,86 @@
+#ifndef CYCOM_DISPLAY_FRAMEBUFFER_H_
+#define CYCOM_DISPLAY_FRAMEBUFFER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "display/rect.h"
+#include "driver/interface/i_display.h"
+
+namespace display {
+
+/**
+ * @brief メモリ上のRGB565フレームバッファ
+ * 
+ * IDisplayを実装しているため、TextRenderer等の描画処理をそのまま向けられる。
+ * 描画された領域はダーティ矩形として記録され、FlushManager がその領域だけをパネルへ転送する。
+ * ピクセルはホスト順のRGB565で保持する。
+ */
+class Framebuffer : public driver::IDisplay {
+public:
+    // 保持するダーティ矩形の上限（超えた分は外接矩形へ統合する）
+    static constexpr size_t kMaxDirtyRects = 16;
+
+    /**
+     * @brief 指定サイズのフレームバッファを確保する（黒で初期化）
+     * 
+     * @param width 幅（ピクセル）
+     * @param height 高さ（ピクセル）
+     */
+    Framebuffer(int width, int height);
+
+    // IDisplayインターフェースの実装
+    void Clear(uint16_t rgb565 = 0xFFFF) override;
+    void DrawRGB565Line(int x, int y, const uint16_t* rgb565, int len) override;
+    void DrawRGB565Rect(int x, int y, int w, int h, const uint16_t* px, int stride_px,
+                        driver::PixelOrder order) override;
+    bool DrawBackgroundImage(const std::string& path) override;
+    int GetWidth() const override { return width_; }
+    int GetHeight() const override { return height_; }
+
+    /**
+     * @brief 矩形領域を指定色で塗りつぶす
+     * 
+     * @param r 塗りつぶす領域（画面外は切り取られる）
+     * @param rgb565 塗りつぶし色
+     */
+    void FillRect(const Rect& r, uint16_t rgb565);
+
+    /**
+     * @brief 領域をダーティとして記録する
+     * 
+     * @param r 記録する領域（画面外は切り取られる）
+     */
+    void MarkDirty(const Rect& r);
+
+    /**
+     * @brief 記録済みのダーティ矩形を取り出し、記録を空にする
+     * 
+     * @param out 取り出し先（上書きされる）
+     */
+    void TakeDirty(std::vector<Rect>& out);
+
+    /**
+     * @brief ピクセル配列の中身を交換する（コピーは発生しない）
+     * 
+     * @param other 交換相手（width * height 要素であること）
+     */
+    void SwapPixels(std::vector<uint16_t>& other);
+
+    uint16_t* Pixels() { return pixels_.data(); }
+    const uint16_t* Pixels() const { return pixels_.data(); }
+    int Stride() const { return width_; }
+    Rect Bounds() const { return Rect{0, 0, width_, height_}; }
+
+private:
+    int width_;
+    int height_;
+    std::vector<uint16_t> pixels_;
+    std::vector<Rect> dirty_;
+};
+
+}  // namespace display
+
+#endif  // CYCOM_DISPLAY_FRAMEBUFFER_H_
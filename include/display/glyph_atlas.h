@@ -0,0 +1,119 @@
+#ifndef CYCOM_DISPLAY_GLYPH_ATLAS_H_
+#define CYCOM_DISPLAY_GLYPH_ATLAS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "util/mapped_file.h"
+
+namespace ui {
+
+/**
+ * @brief グリフアトラスのファイル形式（リトルエンディアン）
+ * 
+ * [GlyphAtlasHeader][GlyphAtlasFace × face_count][グリフ表・アトラス画像...]
+ * 1つの面（フォント×サイズ）ごとに、codepoint 昇順のグリフ表と、全グリフの8bitαを
+ * 詰め込んだ1枚のアトラス画像（1行 = atlas_width バイト）を持つ。
+ * 各データの先頭は kGlyphAtlasAlign バイト境界に揃える。
+ */
+constexpr char kGlyphAtlasMagic[4] = {'C', 'Y', 'G', 'A'};
+constexpr uint32_t kGlyphAtlasVersion = 1;
+constexpr size_t kGlyphAtlasAlign = 16;
+constexpr size_t kGlyphAtlasNameLen = 32;
+
+struct GlyphAtlasHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t face_count;
+    uint32_t reserved;
+};
+
+struct GlyphAtlasFace {
+    char family[kGlyphAtlasNameLen];  // FreeType の family_name（NUL終端）
+    char style[kGlyphAtlasNameLen];   // FreeType の style_name（NUL終端）
+    uint32_t size_px;
+    uint32_t glyph_count;
+    uint32_t atlas_width;
+    uint32_t atlas_height;
+    uint64_t glyph_offset;  // GlyphAtlasGlyph[glyph_count] のファイル内オフセット
+    uint64_t atlas_offset;  // アトラス画像のファイル内オフセット
+};
+
+struct GlyphAtlasGlyph {
+    uint32_t codepoint;
+    uint32_t index;         // フォント内のグリフ番号（カーニング用）
+    uint16_t x, y;          // アトラス画像内の位置
+    int16_t width, height;
+    int16_t left, top;      // bitmap_left/top
+    int16_t advance;        // ピクセル
+    int16_t reserved;
+};
+
+static_assert(sizeof(GlyphAtlasHeader) == 16, "GlyphAtlasHeader layout");
+static_assert(sizeof(GlyphAtlasFace) == 96, "GlyphAtlasFace layout");
+static_assert(sizeof(GlyphAtlasGlyph) == 24, "GlyphAtlasGlyph layout");
+
+/**
+ * @brief アトラス内の1面（フォント×サイズ）への参照（データはマップ領域を直接指す）
+ */
+struct GlyphAtlasView {
+    const GlyphAtlasGlyph* glyphs = nullptr;
+    size_t count = 0;
+    const uint8_t* atlas = nullptr;
+    int pitch = 0;  // アトラス画像の1行あたりのバイト数
+
+    /**
+     * @brief コードポイントに対応するグリフを探す
+     * 
+     * @return const GlyphAtlasGlyph* 見つからなければ nullptr
+     */
+    const GlyphAtlasGlyph* Find(uint32_t cp) const;
+
+    /**
+     * @brief グリフのαビットマップの先頭（1行 = pitch バイト）
+     */
+    const uint8_t* Alpha(const GlyphAtlasGlyph& g) const {
+        return atlas + static_cast<size_t>(g.y) * pitch + g.x;
+    }
+};
+
+/**
+ * @brief ビルド時に生成したグリフアトラスをメモリマップして参照するクラス
+ * 
+ * 起動直後やサイズ切り替え直後でも FreeType でラスタライズせずにグリフを使える。
+ * 開けない・形式が不正（グリフの矩形がアトラス画像からはみ出すものを含む）な場合は例外を投げず、
+ * FindFace() が常に false を返す。
+ */
+class GlyphAtlas {
+public:
+    /**
+     * @brief グリフアトラスを開く
+     * 
+     * @param path アトラスファイルのパス
+     */
+    explicit GlyphAtlas(const std::string& path);
+
+    bool IsOpen() const { return faces_ != nullptr; }
+
+    /**
+     * @brief フォントとサイズに対応する面を探す
+     * 
+     * @param family フォントのファミリー名
+     * @param style フォントのスタイル名
+     * @param size_px ピクセルサイズ
+     * @param out 見つかった面
+     * @return true 見つかった
+     * @return false 見つからない
+     */
+    bool FindFace(const char* family, const char* style, int size_px, GlyphAtlasView& out) const;
+
+private:
+    util::MappedFile file_;
+    const GlyphAtlasFace* faces_ = nullptr;
+    uint32_t count_ = 0;
+};
+
+}  // namespace ui
+
+#endif  // CYCOM_DISPLAY_GLYPH_ATLAS_H_
@@ -0,0 +1,169 @@
+#ifndef CYCOM_DISPLAY_PAGE_CACHE_H_
+#define CYCOM_DISPLAY_PAGE_CACHE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace display {
+
+/**
+ * @brief ページキャッシュの追い出し方針
+ */
+enum class PageEvictionPolicy {
+    kLru,   // 最も長く表示されていないページから追い出す
+    kFifo,  // 最も古く描いたページから追い出す
+};
+
+/**
+ * @brief ページの静的部分（背景と固定表示）を描画済みの全画面サーフェスとして保持するキャッシュ
+ *
+ * RAM 上には予算に収まる枚数だけを置き、溢れたときは追い出し方針で選んだページを
+ * mmap したスピルファイルへ移す。スピルファイルも満杯なら同じ方針で選んだページを破棄する
+ * （次に表示するときに描き直す）。スピル側のページを参照すると、RAM 側の1枚と入れ替える。
+ *
+ * サーフェスはキャンバスと同じサイズのホスト順 RGB565。
+ * Find() / Insert() が返すポインタは、次に Find() / Insert() / Erase() / Clear() を呼ぶまで有効。
+ * スレッドセーフではない。
+ */
+class PageCache {
+public:
+    /**
+     * @brief 容量と追い出し方針
+     */
+    struct Config {
+        size_t budget_bytes = 0;  // RAM 上に置くサーフェスの合計バイト数
+        PageEvictionPolicy policy = PageEvictionPolicy::kLru;
+        std::string spill_dir;    // スピルファイルを作るディレクトリ（空ならスピルしない）
+        size_t spill_bytes = 0;   // スピルファイルの最大バイト数
+    };
+
+    /**
+     * @brief ヒット率と使用枚数の統計
+     */
+    struct Stats {
+        uint64_t hits = 0;        // RAM 上で見つかった
+        uint64_t spill_hits = 0;  // スピルファイル上で見つかった
+        uint64_t misses = 0;
+        uint64_t spills = 0;      // RAM からスピルファイルへ移した枚数
+        uint64_t evictions = 0;   // 破棄した枚数
+        size_t ram_pages = 0;
+        size_t spill_pages = 0;
+        size_t ram_capacity = 0;    // RAM 上に置ける枚数
+        size_t spill_capacity = 0;  // スピルファイルに置ける枚数
+    };
+
+    /**
+     * @brief キャッシュを初期化する（RAM 上の領域を確保し、スピルファイルを作る）
+     *
+     * スピルファイルを作れない場合は警告を出し、スピルなしで動作する。
+     * 作ったファイルはマップ後すぐに削除するため、終了後には残らない。
+     *
+     * @param width サーフェスの幅
+     * @param height サーフェスの高さ
+     * @param config 容量と追い出し方針
+     */
+    PageCache(int width, int height, const Config& config);
+
+    PageCache(const PageCache&) = delete;
+    PageCache& operator=(const PageCache&) = delete;
+
+    ~PageCache();
+
+    /**
+     * @brief ページのサーフェスを探し、表示したものとして記録する
+     *
+     * @param page ページ番号
+     * @return const uint16_t* サーフェスの先頭（見つからなければ nullptr）
+     */
+    const uint16_t* Find(int page);
+
+    /**
+     * @brief ページのサーフェスを確保する（既存のものは置き換える）
+     *
+     * 必要なら他のページをスピルファイルへ移すか破棄する。呼び出し側は返った領域へ描画結果を書き込む。
+     *
+     * @param page ページ番号
+     * @return uint16_t* 確保したサーフェス（RAM・スピルとも容量が0なら nullptr）
+     */
+    uint16_t* Insert(int page);
+
+    /**
+     * @brief ページのサーフェスを破棄する（ページの静的部分が変わったときなど）
+     *
+     * @param page ページ番号
+     */
+    void Erase(int page);
+
+    /**
+     * @brief 全ページを破棄する（統計のヒット・ミス数は保持）
+     */
+    void Clear();
+
+    Stats GetStats() const;
+
+    size_t FrameBytes() const { return frame_px_ * sizeof(uint16_t); }
+
+private:
+    struct Entry {
+        int page;
+        bool in_ram;        // false ならスピルファイル上
+        size_t slot;        // 各領域内のサーフェス番号
+        uint64_t inserted;  // 描いた順（FIFO 用）
+        uint64_t used;      // 最後に表示した順（LRU 用）
+    };
+
+    /**
+     * @brief スピルファイルを作成してマップする（失敗したらスピルなし）
+     *
+     * dir がなければ 0700 で作る。自身の所有でない、またはグループ・他者が書き込める
+     * ディレクトリは使わない。ファイルは名前のない一時ファイル（O_TMPFILE、使えなければ
+     * mkstemp で作ってすぐ削除）とし、既存のファイルやシンボリックリンクは開かない。
+     */
+    void OpenSpill(const std::string& dir, size_t slots);
+
+    /**
+     * @brief dir に名前のない読み書き用の一時ファイルを作る
+     *
+     * @return int ファイル記述子（失敗したら -1）
+     */
+    static int CreateSpillFile(const std::string& dir);
+
+    uint16_t* SlotPixels(bool in_ram, size_t slot);
+    std::vector<Entry>::iterator FindEntry(int page);
+
+    /**
+     * @brief 追い出し方針で次に追い出すエントリを選ぶ
+     */
+    std::vector<Entry>::iterator Victim(bool in_ram);
+
+    /**
+     * @brief 指定領域の空きサーフェスを用意する（満杯なら1枚を移すか破棄する）
+     *
+     * @return size_t 空いたサーフェス番号
+     */
+    size_t TakeSlot(bool in_ram);
+
+    bool SlotUsed(bool in_ram, size_t slot) const;
+
+    size_t frame_px_;
+    PageEvictionPolicy policy_;
+    size_t ram_slots_;
+    std::unique_ptr<uint16_t[]> ram_;
+    size_t spill_slots_ = 0;
+    uint16_t* spill_ = nullptr;  // スピルファイルのマップ（nullptr=スピルなし）
+    size_t spill_map_bytes_ = 0;
+    std::vector<Entry> entries_;
+    uint64_t clock_ = 0;
+    uint64_t hits_ = 0;
+    uint64_t spill_hits_ = 0;
+    uint64_t misses_ = 0;
+    uint64_t spills_ = 0;
+    uint64_t evictions_ = 0;
+};
+
+}  // namespace display
+
+#endif  // CYCOM_DISPLAY_PAGE_CACHE_H_
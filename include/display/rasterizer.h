@@ -0,0 +1,204 @@
+#ifndef CYCOM_DISPLAY_RASTERIZER_H_
+#define CYCOM_DISPLAY_RASTERIZER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "display/framebuffer.h"
+#include "display/rect.h"
+
+namespace display {
+
+/**
+ * @brief 浮動小数点の座標（ピクセル単位。画素 (x, y) の中心は (x + 0.5, y + 0.5)）
+ */
+struct PointF {
+    float x;
+    float y;
+};
+
+/**
+ * @brief 自己交差・重なりのある図形の内側の判定方法
+ */
+enum class FillRule {
+    kNonZero,  // 巻き数が0以外なら内側（重ねた図形は和集合になる）
+    kEvenOdd,  // 巻き数が奇数なら内側（内側の輪郭が穴になる）
+};
+
+/**
+ * @brief アンチエイリアスつきのスキャンライン方式ベクタラスタライザ
+ *
+ * 輪郭を 24.8 固定小数点の辺に変換して保持し、Fill() で1行ずつ、各セル（画素）の
+ * 被覆面積と巻き数の差分を累積してから左から走査して被覆率を求め、同じ被覆率が続く区間
+ * （スパン）単位でフレームバッファへ合成する。辺の x 座標は行ごとに固定小数点で進める。
+ *
+ * 作業領域（辺・1行分のセル・被覆率）は使い回すため、同程度の図形を描き続ける限り
+ * Fill() でメモリ確保は発生しない。描いた画素を囲む最小の矩形をダーティとして記録する。
+ *
+ * 角度は度単位で、0° が右（3時方向）、正の値が時計回り（画面座標は y が下向き）。
+ * スレッドセーフではない。
+ */
+class Rasterizer {
+public:
+    Rasterizer() = default;
+
+    /**
+     * @brief 以後の Fill() で描画する領域を制限する（既定はキャンバス全体）
+     *
+     * @param clip 描画してよい領域
+     */
+    void SetClip(const Rect& clip);
+
+    /**
+     * @brief 描画領域の制限を解除する
+     */
+    void ResetClip();
+
+    /**
+     * @brief 新しい輪郭を始める（描きかけの輪郭は閉じる）
+     */
+    void MoveTo(float x, float y);
+
+    /**
+     * @brief 現在の点から直線を引く
+     */
+    void LineTo(float x, float y);
+
+    /**
+     * @brief 描きかけの輪郭を始点へ戻して閉じる
+     */
+    void Close();
+
+    /**
+     * @brief 多角形を輪郭として追加する
+     *
+     * @param pts 頂点の並び（閉じる辺は自動で追加する）
+     * @param n 頂点数
+     */
+    void AddPolygon(const PointF* pts, size_t n);
+
+    /**
+     * @brief 太さのある線分を追加する（端は線分の端点で直角に切る）
+     *
+     * @param x0 始点X
+     * @param y0 始点Y
+     * @param x1 終点X
+     * @param y1 終点Y
+     * @param width 線の太さ
+     */
+    void AddLine(float x0, float y0, float x1, float y1, float width);
+
+    /**
+     * @brief 塗りつぶした円を追加する
+     *
+     * @param cx 中心X
+     * @param cy 中心Y
+     * @param r 半径
+     */
+    void AddCircle(float cx, float cy, float r);
+
+    /**
+     * @brief 太さのある円弧を追加する（360° 以上ならリング）
+     *
+     * @param cx 中心X
+     * @param cy 中心Y
+     * @param r 線の中心の半径
+     * @param start_deg 開始角
+     * @param sweep_deg 描く角度（負なら反時計回り）
+     * @param width 線の太さ
+     */
+    void AddArc(float cx, float cy, float r, float start_deg, float sweep_deg, float width);
+
+    /**
+     * @brief 追加した輪郭を塗りつぶしてキャンバスへ合成し、輪郭を破棄する
+     *
+     * @param canvas 描画先
+     * @param rgb565 塗りつぶし色
+     * @param rule 内側の判定方法
+     * @param opacity 不透明度（0〜255。被覆率に掛ける）
+     * @return Rect 描いた画素を囲む最小の矩形（ダーティとして記録済み。何も描かなければ空）
+     */
+    Rect Fill(Framebuffer& canvas, uint16_t rgb565, FillRule rule = FillRule::kNonZero,
+              uint8_t opacity = 255);
+
+    /**
+     * @brief 追加した輪郭を描かずに破棄する
+     */
+    void Reset();
+
+private:
+    // 24.8 固定小数点
+    static constexpr int kSubpixelBits = 8;
+    static constexpr int kOne = 1 << kSubpixelBits;
+
+    /**
+     * @brief 辺（y0 < y1 に正規化済み）と、行ごとに進める x の状態
+     */
+    struct Edge {
+        int32_t x0, y0, x1, y1;
+        int dir;        // +1: 元の向きが下向き、-1: 上向き
+        int64_t slope;  // y が1サブピクセル進むごとの x の変化（下位16ビットは小数部）
+        int64_t xf;     // 処理中の行の上端での x（同上）
+    };
+
+    /**
+     * @brief 1行分のセル（FreeType の gray ラスタライザと同じ表現）
+     */
+    struct Cell {
+        int32_t cover;  // この画素を通る辺の y 方向の移動量の和
+        int32_t area;   // 辺の左側の面積の2倍の和
+    };
+
+    static int32_t ToFixed(float v);
+    void AddEdge(int32_t x0, int32_t y0, int32_t x1, int32_t y1);
+
+    /**
+     * @brief 円弧上の点を並べる（角度の刻みは半径から誤差が1/32ピクセル以下になるよう決める）
+     */
+    void AppendArc(float cx, float cy, float r, float start_rad, float sweep_rad, bool move);
+
+    /**
+     * @brief 処理中の行に、行内の線分を左右の描画範囲で切って積む
+     *
+     * 座標は行の左上を原点とし、x は描画範囲の左端からの 24.8、y は行内の 0〜kOne。
+     */
+    void RenderClipped(int64_t x1, int32_t y1, int64_t x2, int32_t y2);
+
+    /**
+     * @brief 処理中の行に、描画範囲内の線分のセルへの寄与を積む
+     */
+    void RenderScanline(int64_t x1, int32_t y1, int64_t x2, int32_t y2);
+
+    void AddCell(int ex, int32_t cover, int32_t area);
+
+    /**
+     * @brief 処理中の行のセルを走査して被覆率をスパン単位でキャンバスへ合成する
+     *
+     * @return true 1画素以上描いた
+     */
+    bool SweepRow(uint16_t* row, uint16_t rgb565, FillRule rule, uint8_t opacity, int* x_min,
+                  int* x_max);
+
+    std::vector<Edge> edges_;
+    std::vector<size_t> active_;  // 処理中の行と交わる辺
+    std::vector<Cell> cells_;     // 1行分（描画範囲の幅 + 1）
+    std::vector<uint8_t> alpha_;  // 1行分の被覆率
+    int cell_min_ = 0;            // 処理中の行で触れたセルの範囲
+    int cell_max_ = -1;
+    int row_width_ = 0;           // 描画範囲の幅
+
+    bool has_clip_ = false;
+    Rect clip_;
+
+    // 輪郭の状態（24.8）
+    bool open_ = false;
+    int32_t start_x_ = 0, start_y_ = 0;
+    int32_t cur_x_ = 0, cur_y_ = 0;
+    int32_t min_x_ = 0, min_y_ = 0, max_x_ = 0, max_y_ = 0;  // 全頂点の外接矩形
+    bool has_points_ = false;
+};
+
+}  // namespace display
+
+#endif  // CYCOM_DISPLAY_RASTERIZER_H_
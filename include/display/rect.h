@@ -0,0 +1,58 @@
+#ifndef CYCOM_DISPLAY_RECT_H_
+#define CYCOM_DISPLAY_RECT_H_
+
+#include <algorithm>
+
+namespace display {
+
+/**
+ * @brief 画面上の矩形領域（左上原点、幅・高さはピクセル単位）
+ */
+struct Rect {
+    int x = 0;
+    int y = 0;
+    int w = 0;
+    int h = 0;
+
+    bool Empty() const { return w <= 0 || h <= 0; }
+    int Right() const { return x + w; }   // 右端（含まない）
+    int Bottom() const { return y + h; }  // 下端（含まない）
+    long Area() const { return Empty() ? 0 : static_cast<long>(w) * h; }
+
+    /**
+     * @brief 2つの矩形を包含する最小の矩形を返す（空の矩形は無視する）
+     */
+    static Rect Union(const Rect& a, const Rect& b) {
+        if (a.Empty()) return b;
+        if (b.Empty()) return a;
+        const int x0 = std::min(a.x, b.x);
+        const int y0 = std::min(a.y, b.y);
+        const int x1 = std::max(a.Right(), b.Right());
+        const int y1 = std::max(a.Bottom(), b.Bottom());
+        return Rect{x0, y0, x1 - x0, y1 - y0};
+    }
+
+    /**
+     * @brief 2つの矩形の共通部分を返す（重ならない場合は空）
+     */
+    static Rect Intersect(const Rect& a, const Rect& b) {
+        const int x0 = std::max(a.x, b.x);
+        const int y0 = std::max(a.y, b.y);
+        const int x1 = std::min(a.Right(), b.Right());
+        const int y1 = std::min(a.Bottom(), b.Bottom());
+        if (x1 <= x0 || y1 <= y0) return Rect{};
+        return Rect{x0, y0, x1 - x0, y1 - y0};
+    }
+
+    /**
+     * @brief 重なっているか辺で接しているかを判定する
+     */
+    bool Touches(const Rect& o) const {
+        return !Empty() && !o.Empty() && x <= o.Right() && o.x <= Right() && y <= o.Bottom() &&
+               o.y <= Bottom();
+    }
+};
+
+}  // namespace display
+
+#endif  // CYCOM_DISPLAY_RECT_H_
@@ -0,0 +1,87 @@
+#ifndef CYCOM_DISPLAY_RLE_ICON_H_
+#define CYCOM_DISPLAY_RLE_ICON_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "display/rect.h"
+#include "driver/interface/i_display.h"
+
+namespace ui {
+
+/**
+ * @brief ランの種類（ops の上位2ビット）
+ */
+enum class RleOp : uint8_t {
+    kSkip = 0,   // 透明（データなし）
+    kSolid = 1,  // 不透明の単色（colors を1つ使う）
+    kCopy = 2,   // 不透明の画素列（colors を長さ分使う）
+    kAlpha = 3,  // 半透明の画素列（colors と alphas を長さ分使う）
+};
+
+/**
+ * @brief ランレングス圧縮したアイコン（ビルド時に cycom_icon_rle が生成する）
+ *
+ * 各行を左から、同じ種類の画素が続く区間（ラン）の並びとして表す。ランは行をまたがず、
+ * 1行のランの長さの和は width に等しい。ops の1バイトが1つのランで、上位2ビットが RleOp、
+ * 下位6ビットが長さ - 1（1〜kMaxRun 画素）。色（ホスト順 RGB565）と不透明度は別の配列に
+ * ランの順に詰める。
+ */
+struct RleIcon {
+    static constexpr int kMaxRun = 64;
+
+    const char* name;        // 元画像のファイル名（拡張子なし）
+    int16_t width, height;
+    const uint8_t* ops;
+    size_t op_count;
+    const uint16_t* colors;
+    const uint8_t* alphas;   // 半透明の画素がなければ nullptr
+    uint32_t opaque_px;      // 透明でない画素数
+};
+
+/**
+ * @brief 組み込みアイコンを名前で探す
+ *
+ * @param name 元画像のファイル名（拡張子なし。例: "gps_fix"）
+ * @return const RleIcon* 見つからなければ nullptr
+ */
+const RleIcon* FindRleIcon(const char* name);
+
+/**
+ * @brief アイコンを描画先へ展開する
+ *
+ * ランを直接書き込み、透明なランは読み飛ばす。半透明のランは描画先の画素と合成する。
+ * 処理時間は透明でない画素数に比例する。描画先を kPanel 順にすれば、パネル転送用の
+ * バッファへ直接展開できる。ダーティ領域は記録しない。
+ *
+ * @param icon アイコン
+ * @param dst 描画先の左上の画素
+ * @param stride 描画先の1行あたりの画素数
+ * @param x アイコンの左上X（描画先の座標）
+ * @param y アイコンの左上Y（描画先の座標）
+ * @param clip 書き込んでよい範囲（描画先の座標）
+ */
+template <driver::PixelOrder O>
+void BlitRleIcon(const RleIcon& icon, uint16_t* dst, int stride, int x, int y,
+                 const display::Rect& clip);
+
+/**
+ * @brief アイコンの透明でない画素だけを背景に戻す（ホスト順の描画先のみ）
+ *
+ * 次のアイコンを描く前に前のアイコンを消すために使う。処理時間は透明でない画素数に比例する。
+ *
+ * @param icon 消すアイコン
+ * @param dst 描画先の左上の画素
+ * @param stride 描画先と layer の1行あたりの画素数
+ * @param x アイコンの左上X
+ * @param y アイコンの左上Y
+ * @param clip 書き込んでよい範囲
+ * @param layer 背景（描画先と同じサイズ。nullptr なら fill で塗る）
+ * @param fill 背景色
+ */
+void EraseRleIcon(const RleIcon& icon, uint16_t* dst, int stride, int x, int y,
+                  const display::Rect& clip, const uint16_t* layer, uint16_t fill);
+
+}  // namespace ui
+
+#endif  // CYCOM_DISPLAY_RLE_ICON_H_
@@ -0,0 +1,84 @@
+#ifndef CYCOM_DISPLAY_SDF_GLYPH_H_
+#define CYCOM_DISPLAY_SDF_GLYPH_H_
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "util/lru_arena.h"
+
+namespace ui {
+
+/**
+ * @brief 任意サイズへ描画したSDFグリフ（alpha は次の Render() まで有効）
+ */
+struct SdfBitmap {
+    int width = 0, height = 0;
+    int left = 0, top = 0;     // bitmap_left/top 相当
+    int advance = 0;           // ピクセル
+    uint32_t index = 0;        // フォント内のグリフ番号（カーニング用）
+    const uint8_t* alpha = nullptr;  // 1行 = width バイト
+};
+
+/**
+ * @brief 符号付き距離場（SDF）グリフのキャッシュ
+ * 
+ * 各文字を基準サイズ kBasePx の距離場として1つだけ保持し、描画サイズごとに
+ * 双線形サンプリングと smoothstep によるしきい値処理でαへ変換する。
+ * 保持するデータは描画サイズの種類に依存しないため、サイズを切り替えても再ラスタライズは発生しない。
+ * 
+ * 距離場は kBasePx * kOversample でラスタライズしたビットマップから求める。
+ * 値は 128 が輪郭、1 あたり kSpreadPx / 127 ピクセル（基準サイズ）で内側ほど大きい。
+ */
+class SdfGlyphCache {
+public:
+    static constexpr int kBasePx = 32;      // 距離場の基準ピクセルサイズ
+    static constexpr int kSpreadPx = 4;     // 距離を表現する範囲（基準サイズでのピクセル）
+    static constexpr int kOversample = 4;   // 距離計算用ラスタライズの倍率
+    static constexpr size_t kDefaultBudgetBytes = 256 * 1024;
+
+    explicit SdfGlyphCache(size_t budget_bytes = kDefaultBudgetBytes);
+
+    /**
+     * @brief 文字を指定サイズで描画する
+     * 
+     * 距離場がなければ生成する。生成時は face のピクセルサイズを一時的に変更し、size_px に戻す。
+     * 
+     * @param face フォント
+     * @param cp コードポイント
+     * @param size_px 描画サイズ
+     * @param out 描画結果
+     * @return true 成功（空グリフを含む）
+     * @return false 文字を読み込めない
+     */
+    bool Render(FT_Face face, uint32_t cp, int size_px, SdfBitmap& out);
+
+    void SetBudget(size_t budget_bytes) { fields_.SetBudget(budget_bytes); }
+    util::LruArena::Stats GetStats() const { return fields_.GetStats(); }
+
+private:
+    // アリーナ上で距離場の直前に置く情報（座標は基準サイズ、距離場の余白を含む）
+    struct FieldHeader {
+        int16_t width, height;
+        int16_t left, top;
+        int32_t advance_16_16;  // 基準サイズでのヒンティングなし送り幅（16.16）
+        uint32_t index;
+    };
+
+    const uint8_t* buildField(FT_Face face, uint32_t cp, int size_px);
+    void updateCoverageTable(int size_px);
+
+    util::LruArena fields_;
+    std::vector<uint8_t> raster_;     // 距離計算用の2値ビットマップ
+    std::vector<uint8_t> out_;        // Render() の出力
+    std::vector<int> col_;            // Render() の出力列 → 距離場の x（8bit固定小数点）
+    int lut_size_px_ = 0;
+    uint8_t coverage_[256] = {};      // 距離場の値 → α（描画サイズごと）
+};
+
+}  // namespace ui
+
+#endif  // CYCOM_DISPLAY_SDF_GLYPH_H_
@@ -0,0 +1,28 @@
+#ifndef CYCOM_DISPLAY_SURFACE_H_
+#define CYCOM_DISPLAY_SURFACE_H_
+
+#include <cstdint>
+
+namespace display {
+
+/**
+ * @brief 読み取り専用のRGB565（ホスト順）ピクセル領域への参照
+ * 
+ * ピクセルの所有権は持たない。参照先の寿命は呼び出し側が管理する。
+ */
+struct SurfaceView {
+    const uint16_t* pixels = nullptr;
+    int width = 0;
+    int height = 0;
+    int stride = 0;  // 1行あたりのピクセル数
+    uint64_t version = 0;  // 内容の版（参照先の内容が変わるたびに変わる。描画結果のキャッシュ判定用）
+
+    bool Valid() const { return pixels != nullptr && width > 0 && height > 0; }
+    bool Contains(int x, int y) const { return x >= 0 && y >= 0 && x < width && y < height; }
+    const uint16_t* Row(int y) const { return pixels + static_cast<long>(y) * stride; }
+    uint16_t At(int x, int y) const { return Row(y)[x]; }
+};
+
+}  // namespace display
+
+#endif  // CYCOM_DISPLAY_SURFACE_H_
@@ -5,11 +5,17 @@
 #include FT_FREETYPE_H
 
 #include <cstdint>
+#include <list>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+#include "display/baked_font.h"
+#include "display/glyph_atlas.h"
+#include "display/sdf_glyph.h"
+#include "display/surface.h"
 #include "driver/interface/i_display.h"
+#include "util/lru_arena.h"
 
 namespace ui {
 
@@ -24,50 +30,184 @@ struct Color565 {
     static Color565 Gray()  { return {0x7BEF}; }
 };
 
+// フォントの読み込み元（ファイル、またはメモリ上のフォントデータ）
+struct FontSource {
+    std::string path;               // data が nullptr のときに使用
+    const uint8_t* data = nullptr;  // TextRenderer より長く生存すること
+    size_t size = 0;
+
+    static FontSource File(const std::string& path) { return FontSource{path, nullptr, 0}; }
+    static FontSource Memory(const uint8_t* data, size_t size) {
+        return FontSource{std::string(), data, size};
+    }
+};
+
 struct TextMetrics {
     int width_px;
     int height_px;
     int baseline_px;
 };
 
+// DrawLabel と同じ規則で配置した文字列の位置（座標は描画先の絶対座標）
+struct LabelPlacement {
+    int pen_x = 0, pen_y = 0;  // 1行目のベースライン左端
+    struct Glyph {
+        uint32_t codepoint;
+        int x;  // ペン位置（送り幅の区切り）
+    };
+    std::vector<Glyph> glyphs;
+    TextMetrics metrics{0, 0, 0};
+};
+
+// グリフの生成方式
+enum class GlyphMode {
+    kBitmap,  // サイズごとに FreeType でラスタライズしてキャッシュする
+    kSdf,     // 文字ごとに1つの距離場を持ち、任意サイズへしきい値処理で描画する
+};
+
+// グリフキャッシュの統計（alpha: 8bitαのグリフ、rendered: 色ごとに合成済みのRGB565グリフ）
+struct GlyphCacheStats {
+    util::LruArena::Stats alpha;
+    util::LruArena::Stats rendered;
+    uint64_t baked_hits = 0;  // ビルド時の組み込み表から取得した回数（FreeType を使わない）
+    uint64_t atlas_hits = 0;  // グリフアトラスから取得した回数（FreeType を使わない）
+    util::LruArena::Stats sdf;  // 距離場（GlyphMode::kSdf のみ使用）
+    util::LruArena::Stats labels;  // 合成済みラベル（DrawLabel）
+};
+
 class TextRenderer {
 public:
+    static constexpr int kMaxFontSizePx = 1023;  // キャッシュキーに収まる最大サイズ
+    static constexpr size_t kDefaultAlphaCacheBytes = 256 * 1024;
+    static constexpr size_t kDefaultRenderedCacheBytes = 512 * 1024;
+    static constexpr size_t kMaxCachedLayouts = 64;  // 配置結果を保持する文字列数
+    static constexpr size_t kDefaultLabelCacheBytes = 256 * 1024;
+
     // font_path に .ttf / .otf を指定
     TextRenderer(driver::IDisplay& lcd, const std::string& font_path);
+    // メモリ上のフォント（mmap したアセットパック等）からも生成できる
+    TextRenderer(driver::IDisplay& lcd, const FontSource& font);
     ~TextRenderer();
 
     void SetFontSizePx(int px);
     void SetColors(Color565 fg, Color565 bg);
     void SetLineGapPx(int px);
     void SetWrapWidthPx(int px);  // 0 で折り返しなし
+    // true にすると数字 0〜9 を同じ幅（最も広い数字の送り幅）で並べ、値の変化で桁が揺れないようにする
+    void SetTabularFigures(bool on);
+
+    // 背景レイヤを設定すると、グリフのαを bg_ ではなくレイヤの実ピクセルに対して合成する
+    // （描画先と同じ座標系のレイヤを渡す。無効な SurfaceView で解除）
+    void SetBackgroundLayer(const display::SurfaceView& layer);
+
+    // 事前ラスタライズ済みのグリフアトラスを設定する（nullptr で解除。TextRenderer より長く生存すること）
+    // アトラスにない文字・サイズだけを FreeType で描画する
+    void SetGlyphAtlas(const GlyphAtlas* atlas);
+
+    // 組み込み表・アトラスにない文字の生成方式を切り替える（既定は kBitmap）
+    void SetGlyphMode(GlyphMode mode);
+
+    // グリフキャッシュの容量（バイト）を設定する（キャッシュ済みのグリフは破棄される）
+    void SetGlyphCacheBudget(size_t alpha_bytes, size_t rendered_bytes);
+    // 合成済みラベルのキャッシュ容量（バイト）を設定する（0 で無効）
+    void SetLabelCacheBudget(size_t bytes);
+    GlyphCacheStats CacheStats() const;
 
     // (x,y) はベースライン基準（左下寄り）
     TextMetrics DrawText(int x, int y, const std::string& utf8);
-    TextMetrics MeasureText(const std::string& utf8) const;
+    // 実際のグリフ送り幅とカーニングで寸法を求める（配置結果はキャッシュされ、描画時に再利用される）
+    TextMetrics MeasureText(const std::string& utf8);
 
-    // パネル塗り→中央寄せ描画
+    // 領域全体を作業バッファ上で背景（レイヤまたは bg_）から組み立て、1矩形で転送する
+    // （前回の文字列の残りは背景で上書きされる。center=false なら左寄せ）
+    // 文字列・サイズ・色・領域・背景が同じ組み立て結果はキャッシュから直接転送する
     TextMetrics DrawLabel(int panel_x, int panel_y, int panel_w, int panel_h,
                           const std::string& utf8, bool center = true);
+    // DrawLabel と同じ規則で文字列を領域内に配置し、各文字の位置を返す（描画はしない）
+    void PlaceLabel(int panel_x, int panel_y, int panel_w, int panel_h,
+                    const std::string& utf8, bool center, LabelPlacement& out);
+    // DrawLabel の結果のうち矩形 part だけを組み立てて転送する（桁ごとの差分更新用）
+    // 文字列全体を pen_x/pen_y に置いて part で切り取るため、DrawLabel と同じ画素になる
+    // 変化のたびに内容が変わるため、ラベルキャッシュは使わない
+    void DrawLabelPart(int part_x, int part_y, int part_w, int part_h,
+                       int pen_x, int pen_y, const std::string& utf8);
 
 private:
+    // キャッシュ内のグリフ情報（アリーナ上でビットマップの直前に置く）
+    struct GlyphHeader {
+        int16_t width, height;
+        int16_t left, top;         // bitmap_left/top
+        int16_t advance;           // ピクセル
+        int16_t pitch;             // row bytes
+        uint32_t index;            // フォント内のグリフ番号（カーニング用）
+    };
+    // グリフへの参照（alpha は次にグリフを読み込むまで有効）
     struct Glyph {
         int width = 0, height = 0;
-        int left = 0, top = 0;     // bitmap_left/top
-        int advance = 0;           // ピクセル
-        int pitch = 0;             // row bytes
-        std::vector<uint8_t> alpha; // 8bit alpha bitmap
+        int left = 0, top = 0;
+        int advance = 0;
+        int pitch = 0;
+        uint32_t index = 0;
+        const uint8_t* alpha = nullptr; // 8bit alpha bitmap
     };
+    // 配置済みの1グリフ（ペン位置は文字列の原点＝1行目のベースライン左端からの相対）
+    struct PlacedGlyph {
+        uint32_t cp;
+        int x, y;
+    };
+    struct Layout {
+        std::vector<PlacedGlyph> glyphs;
+        TextMetrics metrics;
+        int block_h = 0;  // 1行目のアセンダから最終行のディセンダまでの高さ（中央寄せ用）
+    };
+    using LayoutList = std::list<std::pair<std::string, Layout>>;
     using GlyphKey = uint64_t;
+    // [size:10][cp:21]
     static GlyphKey MakeKey(int size_px, uint32_t cp) {
         return (static_cast<uint64_t>(size_px) << 21) | (cp & 0x1FFFFF);
     }
+    // [fg:16][bg:16][size:10][cp:21]
+    static GlyphKey MakeRenderedKey(int size_px, uint32_t cp, uint16_t fg, uint16_t bg) {
+        return (static_cast<uint64_t>(fg) << 47) | (static_cast<uint64_t>(bg) << 31) |
+               MakeKey(size_px, cp);
+    }
 
+    // 現在のフォント・サイズに対応する組み込み表とアトラス面を選ぶ
+    void selectPrebuiltGlyphs();
     Glyph loadGlyph(uint32_t cp);
-    const Glyph* getGlyph(uint32_t cp);
+    Glyph getGlyph(uint32_t cp);
+    const uint16_t* getRenderedGlyph(uint32_t cp, const Glyph& g);
+
+    // 合成済みラベルのキャッシュ内のエントリ（ピクセル、キー文字列の順に続く）
+    struct LabelHeader {
+        uint32_t key_len;
+        int32_t width, height;
+        TextMetrics metrics;
+    };
+    void makeLabelKey(int x, int y, int w, int h, bool center, const std::string& utf8);
+    // DrawLabel のペン位置（1行目のベースライン左端）を求める
+    void labelOrigin(int x, int y, int w, int h, const std::string& utf8, bool center,
+                     int* pen_x, int* pen_y);
+    // 作業バッファに矩形を背景から組み立て、文字列を (pen_x, pen_y) に置いて合成する
+    TextMetrics composeLabel(int x, int y, int w, int h, int pen_x, int pen_y,
+                             const std::string& utf8);
+    static uint64_t HashKey(const std::string& key);
+
+    // 現在のサイズ・折り返し幅等で文字列を配置する（キャッシュになければ作る）
+    const Layout& getLayout(const std::string& utf8);
+    Layout buildLayout(const std::string& utf8);
+    int digitCellWidth();
+
+    // 配置済みの文字列について、各グリフごとに emit(pen_x, pen_y, cp, glyph) を呼ぶ
+    template <typename Emit>
+    TextMetrics layoutText(int x, int y, const std::string& utf8, Emit&& emit);
+    // 作業バッファ（原点 = (origin_x, origin_y)）へグリフを合成する
+    // bg_ のままの行には合成済みグリフを写す
+    void composeGlyph(int pen_x, int pen_y, uint32_t cp, const Glyph& g,
+                      int origin_x, int origin_y, int w, int h);
 
     static bool NextCodepoint(const std::string& s, size_t& i, uint32_t& cp);
-    void blitGlyph(int dst_x, int dst_y, const Glyph& g);
-    static inline uint16_t Blend565(uint16_t bg, uint16_t fg, uint8_t a);
+    void blitGlyph(int dst_x, int dst_y, uint32_t cp, const Glyph& g);
 
 private:
     driver::IDisplay& lcd_;
@@ -79,8 +219,27 @@ private:
     Color565 bg_ = Color565::White();
     int line_gap_px_ = 4;
     int wrap_width_px_ = 0;
-
-    std::unordered_map<GlyphKey, Glyph> cache_;
+    bool tabular_ = false;
+    display::SurfaceView layer_;
+    const BakedFont* baked_ = nullptr;  // 現在のサイズの組み込み表（なければ nullptr）
+    const GlyphAtlas* atlas_ = nullptr;
+    GlyphAtlasView atlas_face_;         // 現在のサイズのアトラス面（なければ空）
+    uint64_t baked_hits_ = 0;
+    uint64_t atlas_hits_ = 0;
+    GlyphMode mode_ = GlyphMode::kBitmap;
+    SdfGlyphCache sdf_;
+
+    util::LruArena alpha_cache_{kDefaultAlphaCacheBytes};       // 1段目: 8bitαのグリフ
+    util::LruArena rendered_cache_{kDefaultRenderedCacheBytes}; // 2段目: 単色背景に合成済み
+    std::vector<uint8_t> uncached_alpha_;  // キャッシュに収まらないグリフ用
+    std::vector<uint16_t> line_;           // 背景レイヤ合成用の1行バッファ
+    std::vector<uint16_t> label_buf_;      // DrawLabel の作業バッファ（使い回す）
+    util::LruArena label_cache_{kDefaultLabelCacheBytes};  // 合成済みラベル
+    std::string label_key_;                // ラベルキャッシュのキー（使い回す）
+
+    // 配置結果のキャッシュ（キーは配置条件＋文字列、先頭が最近使用したもの）
+    LayoutList layouts_;
+    std::unordered_map<std::string, LayoutList::iterator> layout_index_;
 };
 
 } // namespace ui
@@ -4,6 +4,7 @@
 #include <atomic>
 #include <thread>
 #include "driver/interface/i_touch.h"
+#include "util/update_notifier.h"
 
 namespace display {
 
@@ -12,6 +13,7 @@ namespace display {
  * 
  * コンストラクタでタッチ監視スレッドを自動起動し、デストラクタで安全に停止する。
  * GPIO割り込みイベントでタッチコントローラをポーリングし、タッチ座標を内部に保存する。
+ * 横方向のスワイプを検出すると kUpdateSwipeLeft / kUpdateSwipeRight を通知する。
  */
 class TouchManager {
 public:
@@ -19,8 +21,9 @@ public:
      * @brief TouchManager を初期化し、タッチ監視スレッドを自動起動する
      * 
      * @param touch タッチコントローラへの参照
+     * @param notifier タッチ状態の変化・スワイプの通知先（nullptr で通知しない）
      */
-    explicit TouchManager(driver::ITouch& touch);
+    explicit TouchManager(driver::ITouch& touch, util::UpdateNotifier* notifier = nullptr);
 
     /**
      * @brief タッチ監視スレッドを安全に停止させる
@@ -51,6 +54,7 @@ private:
     void TouchLoop();
 
     driver::ITouch& touch_;
+    util::UpdateNotifier* notifier_;
     
     std::thread th_;
     std::atomic<bool> running_{false};
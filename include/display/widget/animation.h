@@ -0,0 +1,133 @@
+#ifndef CYCOM_DISPLAY_WIDGET_ANIMATION_H_
+#define CYCOM_DISPLAY_WIDGET_ANIMATION_H_
+
+#include <chrono>
+#include <cstdint>
+
+namespace ui {
+
+/**
+ * @brief トゥイーンの補間曲線
+ */
+enum class Easing {
+    kLinear,
+    kEaseOut,  // 3次の減速（動き始めが速く、目標値に滑らかに止まる）
+};
+
+/**
+ * @brief 値を目標値へ時間で補間する（トゥイーン）
+ *
+ * 値は経過時間だけで決まるため、フレームが遅れたり間引かれたりしても途中の段階を飛ばして
+ * その時刻の位置を返す。補間中に目標値が変わった場合は、その時点の値から補間し直す。
+ */
+class Tween {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief トゥイーンを生成する（初期値は0で静止）
+     *
+     * @param duration 目標値に達するまでの時間
+     * @param easing 補間曲線
+     */
+    Tween(std::chrono::milliseconds duration, Easing easing);
+
+    /**
+     * @brief 目標値を設定し、現在の値からの補間を始める（目標値が同じなら何もしない）
+     *
+     * @param target 目標値
+     * @param now 現在時刻
+     */
+    void SetTarget(double target, Clock::time_point now);
+
+    /**
+     * @brief 補間せずに値を設定する
+     */
+    void Jump(double value);
+
+    /**
+     * @brief now の時点の値
+     */
+    double Value(Clock::time_point now) const;
+
+    bool Done(Clock::time_point now) const { return now >= end_; }
+    double Target() const { return to_; }
+
+private:
+    std::chrono::milliseconds duration_;
+    Easing easing_;
+    double from_ = 0.0;
+    double to_ = 0.0;
+    Clock::time_point start_{};
+    Clock::time_point end_{};
+};
+
+/**
+ * @brief アニメーション中のフレームを一定周期の時刻に並べるスケジューラ
+ *
+ * フレームは fps で決まる周期の格子の上で始める。描画と転送待ちにかかった時間がフレーム予算
+ * （1周期）を超えた場合は、過ぎた格子の時刻を飛ばして次の時刻から再開し、遅れを取り戻すために
+ * フレームを詰めて描くことはしない。飛ばしたフレームのトゥイーンの段階は描かれずに捨てられる。
+ *
+ * 描画スレッドからのみ使用すること。
+ */
+class AnimationScheduler {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief フレームの統計
+     */
+    struct Stats {
+        uint64_t frames = 0;       // 描いたフレーム数
+        uint64_t over_budget = 0;  // 予算を超えたフレーム数
+        uint64_t dropped = 0;      // 予算超過で飛ばしたフレーム数
+        std::chrono::microseconds last_frame_time{0};   // 描画開始から Present() 完了まで
+        std::chrono::microseconds max_frame_time{0};
+        std::chrono::microseconds total_frame_time{0};
+    };
+
+    /**
+     * @brief スケジューラを生成する
+     *
+     * @param fps アニメーション中のフレームレート（1以上）
+     */
+    explicit AnimationScheduler(int fps);
+
+    /**
+     * @brief 1フレームの予算（周期）
+     */
+    Clock::duration Budget() const { return period_; }
+
+    /**
+     * @brief アニメーション中のフレームを描き終えたことを記録し、次のフレームの時刻を決める
+     *
+     * 静止状態から最初のフレームでは、そのフレームの開始時刻を格子の起点にする。
+     *
+     * @param start フレームの描画開始時刻
+     * @param end フレームの Present() 完了時刻
+     */
+    void FrameDone(Clock::time_point start, Clock::time_point end);
+
+    /**
+     * @brief アニメーションが止まったことを記録する（次の FrameDone() で格子を取り直す）
+     */
+    void Idle() { active_ = false; }
+
+    /**
+     * @brief 次のフレームを始める時刻
+     */
+    Clock::time_point NextFrame() const { return next_; }
+
+    const Stats& GetStats() const { return stats_; }
+
+private:
+    Clock::duration period_;
+    Clock::time_point next_{};
+    bool active_ = false;
+    Stats stats_;
+};
+
+}  // namespace ui
+
+#endif  // CYCOM_DISPLAY_WIDGET_ANIMATION_H_
@@ -0,0 +1,48 @@
+#ifndef CYCOM_DISPLAY_WIDGET_BAR_H_
+#define CYCOM_DISPLAY_WIDGET_BAR_H_
+
+#include <functional>
+
+#include "display/widget/widget.h"
+
+namespace ui {
+
+/**
+ * @brief 値を横棒の長さで表示するウィジェット
+ * 
+ * 値を塗りつぶし幅（ピクセル）へ量子化し、幅が変わったときだけ描き直す。
+ */
+class Bar : public Widget {
+public:
+    using ValueSource = std::function<double()>;
+
+    /**
+     * @brief バーを生成する
+     * 
+     * @param bounds 表示領域
+     * @param source 表示する値を返す関数
+     * @param min_value 左端に対応する値
+     * @param max_value 右端に対応する値
+     * @param fg 塗りつぶし色
+     * @param bg 背景色
+     */
+    Bar(const display::Rect& bounds, ValueSource source, double min_value, double max_value,
+        Color565 fg, Color565 bg);
+
+    void Update() override;
+
+protected:
+    void OnRender(RenderContext& ctx) override;
+
+private:
+    ValueSource source_;
+    double min_;
+    double max_;
+    Color565 fg_;
+    Color565 bg_;
+    int fill_px_ = 0;
+};
+
+}  // namespace ui
+
+#endif  // CYCOM_DISPLAY_WIDGET_BAR_H_
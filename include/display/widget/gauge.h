@@ -0,0 +1,89 @@
+#ifndef CYCOM_DISPLAY_WIDGET_GAUGE_H_
+#define CYCOM_DISPLAY_WIDGET_GAUGE_H_
+
+#include <chrono>
+#include <functional>
+
+#include "display/rasterizer.h"
+#include "display/widget/animation.h"
+#include "display/widget/widget.h"
+
+namespace ui {
+
+/**
+ * @brief 指針式メーターの表示スタイル
+ */
+struct GaugeStyle {
+    Color565 scale = Color565::Black();   // 目盛りの色
+    Color565 needle = Color565::RGB(220, 0, 0);
+    Color565 bg = Color565::White();      // 背景レイヤがない場合の背景色
+    float start_deg = 135.0f;  // 最小値の角度（0° が右、時計回りが正）
+    float sweep_deg = 270.0f;  // 最小値から最大値までの角度
+    int ticks = 7;             // 目盛りの本数（両端を含む）
+    float scale_px = 4.0f;     // 目盛りの円弧の太さ
+    float needle_px = 5.0f;    // 指針の太さ
+};
+
+/**
+ * @brief 値を円弧の目盛りと指針で表示するウィジェット
+ *
+ * データソースの値が変わると、指針は前の位置からトゥイーンで新しい値へ動く。
+ * アニメーション中の各フレームでは、前回描いた指針の外接矩形と今回の外接矩形の和の領域だけを
+ * 背景から描き直すため、1フレームの転送量は指針が掃く範囲に比例する。
+ * 角度の変化が kMinStepDeg 未満のフレームは描かない。
+ *
+ * 領域に他のウィジェットを重ねないこと。
+ */
+class Gauge : public Widget {
+public:
+    using ValueSource = std::function<double()>;
+
+    /**
+     * @brief メーターを生成する
+     *
+     * @param bounds 表示領域（円は短辺に内接する）
+     * @param source 表示する値を返す関数（NaN は最小値として表示）
+     * @param min_value 最小値
+     * @param max_value 最大値
+     * @param tween 値の変化を指針に反映するまでの時間（0なら即座に動かす）
+     * @param style 表示スタイル
+     */
+    Gauge(const display::Rect& bounds, ValueSource source, double min_value, double max_value,
+          std::chrono::milliseconds tween, const GaugeStyle& style);
+
+    void Update() override;
+    bool Animate(std::chrono::steady_clock::time_point now) override;
+    void Invalidate() override;
+
+protected:
+    void OnRender(RenderContext& ctx) override;
+
+private:
+    static constexpr float kMinStepDeg = 0.2f;
+
+    float ValueToAngle(double value) const;
+
+    /**
+     * @brief 指定角度の指針が覆う画素の外接矩形（アンチエイリアスの1画素を含む）
+     */
+    display::Rect NeedleBounds(float angle_deg) const;
+
+    ValueSource source_;
+    double min_;
+    double max_;
+    GaugeStyle style_;
+    Tween tween_;
+
+    // 円の中心・目盛りの半径・指針の長さと軸の半径
+    float cx_, cy_, radius_, needle_len_, hub_r_;
+
+    float angle_;            // 次に描く指針の角度
+    float drawn_angle_;      // 前回描いた指針の角度
+    display::Rect drawn_;    // 前回描いた指針の外接矩形
+    bool full_redraw_ = true;
+    display::Rasterizer ras_;
+};
+
+}  // namespace ui
+
+#endif  // CYCOM_DISPLAY_WIDGET_GAUGE_H_
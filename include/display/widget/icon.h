@@ -0,0 +1,62 @@
+#ifndef CYCOM_DISPLAY_WIDGET_ICON_H_
+#define CYCOM_DISPLAY_WIDGET_ICON_H_
+
+#include <functional>
+#include <vector>
+
+#include "display/rle_icon.h"
+#include "display/widget/widget.h"
+
+namespace ui {
+
+/**
+ * @brief 状態に応じてアイコンを切り替えるウィジェット
+ * 
+ * データソースが返す状態番号が変わったときだけ描き直す。
+ * アイコンは表示領域の中央に配置し、範囲外の状態番号や nullptr のアイコンでは背景のみを描く。
+ *
+ * アイコンはランレングス圧縮のまま展開し、透明な部分は描かない。状態の切り替えでは
+ * 前のアイコンの透明でない画素だけを背景に戻してから次のアイコンを描くため、
+ * 処理時間は領域の広さではなく両アイコンの透明でない画素数に比例する。
+ * 領域全体を描き直すのは初回と Invalidate() された場合のみ。
+ */
+class Icon : public Widget {
+public:
+    using StateSource = std::function<int()>;
+
+    /**
+     * @brief アイコンを生成する
+     * 
+     * @param bounds 表示領域
+     * @param source 状態番号を返す関数
+     * @param images 状態番号ごとのアイコン（FindRleIcon() の結果など）
+     * @param bg 背景色（背景レイヤがない場合に使用）
+     */
+    Icon(const display::Rect& bounds, StateSource source, std::vector<const RleIcon*> images,
+         Color565 bg);
+
+    void Update() override;
+    void Invalidate() override;
+
+protected:
+    void OnRender(RenderContext& ctx) override;
+
+private:
+    const RleIcon* ImageFor(int state) const;
+
+    /**
+     * @brief アイコンを中央に置いたときの矩形
+     */
+    display::Rect Placement(const RleIcon& icon) const;
+
+    StateSource source_;
+    std::vector<const RleIcon*> images_;
+    Color565 bg_;
+    int state_ = -1;
+    const RleIcon* drawn_ = nullptr;  // 前回描いたアイコン
+    bool full_redraw_ = true;
+};
+
+}  // namespace ui
+
+#endif  // CYCOM_DISPLAY_WIDGET_ICON_H_
@@ -0,0 +1,76 @@
+#ifndef CYCOM_DISPLAY_WIDGET_LABEL_H_
+#define CYCOM_DISPLAY_WIDGET_LABEL_H_
+
+#include <functional>
+#include <string>
+
+#include "display/widget/widget.h"
+
+namespace ui {
+
+/**
+ * @brief テキスト系ウィジェットの表示スタイル
+ */
+struct TextStyle {
+    int font_px = 32;
+    Color565 fg = Color565::Black();
+    Color565 bg = Color565::White();  // 背景レイヤがない場合の背景色
+    bool center = true;
+    bool tabular = false;  // 数字を等幅で並べる（値の変化で桁位置が揺れない）
+};
+
+/**
+ * @brief 文字列を表示するウィジェット
+ * 
+ * データソースが返す文字列が前回と異なるときだけ描き直す。
+ */
+class Label : public Widget {
+public:
+    using Source = std::function<std::string()>;
+
+    /**
+     * @brief データソースに結び付いたラベルを生成する
+     * 
+     * @param bounds 表示領域
+     * @param source 表示する文字列を返す関数
+     * @param style 表示スタイル
+     */
+    Label(const display::Rect& bounds, Source source, const TextStyle& style);
+
+    /**
+     * @brief 固定文字列のラベルを生成する
+     * 
+     * @param bounds 表示領域
+     * @param text 表示する文字列
+     * @param style 表示スタイル
+     */
+    Label(const display::Rect& bounds, const std::string& text, const TextStyle& style);
+
+    void Update() override;
+
+    const std::string& Text() const { return text_; }
+
+protected:
+    void OnRender(RenderContext& ctx) override;
+
+    /**
+     * @brief 表示文字列を設定する（変化した場合のみダーティにする）
+     */
+    void SetText(const std::string& text);
+
+    const TextStyle& Style() const { return style_; }
+
+    /**
+     * @brief テキストレンダラに背景レイヤとスタイルを設定する
+     */
+    void PrepareText(RenderContext& ctx) const;
+
+private:
+    Source source_;
+    TextStyle style_;
+    std::string text_;
+};
+
+}  // namespace ui
+
+#endif  // CYCOM_DISPLAY_WIDGET_LABEL_H_
@@ -0,0 +1,73 @@
+#ifndef CYCOM_DISPLAY_WIDGET_NUMERIC_FIELD_H_
+#define CYCOM_DISPLAY_WIDGET_NUMERIC_FIELD_H_
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "display/widget/label.h"
+
+namespace ui {
+
+/**
+ * @brief 数値を指定桁で表示するウィジェット
+ * 
+ * 数値そのものではなく整形後の文字列で変化を判定するため、
+ * 表示桁未満の変動では描き直さない。値が NaN の場合はプレースホルダを表示する。
+ * 数字は style.tabular の指定によらず等幅で並べる。
+ *
+ * 各文字の区画（送り幅の区切り）と文字を覚えておき、区画の配置が前回と同じであれば
+ * 文字が変わった区画だけを組み立て直して転送する（23.4 → 23.5 なら末尾の1桁分のみ）。
+ * 桁数の変化などで配置がずれた場合、背景レイヤが変わった場合、Invalidate() された場合は
+ * 領域全体を描き直す。
+ */
+class NumericField : public Label {
+public:
+    using ValueSource = std::function<double()>;
+
+    /**
+     * @brief 数値フィールドを生成する
+     * 
+     * @param bounds 表示領域
+     * @param source 表示する値を返す関数
+     * @param decimals 小数点以下の桁数
+     * @param style 表示スタイル
+     * @param placeholder 値が無効（NaN）のときに表示する文字列
+     */
+    NumericField(const display::Rect& bounds, ValueSource source, int decimals,
+                 const TextStyle& style, const std::string& placeholder = "--");
+
+    void Update() override;
+    void Invalidate() override;
+
+    /**
+     * @brief 値を整形する（Update() と同じ規則）
+     */
+    std::string Format(double value) const;
+
+protected:
+    void OnRender(RenderContext& ctx) override;
+
+private:
+    // 前回描画した1文字分の区画（x は描画先の絶対座標）
+    struct Cell {
+        uint32_t codepoint;
+        int x0, x1;
+    };
+
+    ValueSource value_source_;
+    int decimals_;
+    std::string placeholder_;
+
+    std::vector<Cell> cells_;     // 空なら次回は全体を描く
+    std::vector<Cell> next_;      // 今回の区画（使い回す）
+    LabelPlacement placement_;    // 今回の配置（使い回す）
+    int pen_y_ = 0;
+    const uint16_t* layer_pixels_ = nullptr;
+    uint64_t layer_version_ = 0;
+};
+
+}  // namespace ui
+
+#endif  // CYCOM_DISPLAY_WIDGET_NUMERIC_FIELD_H_
@@ -0,0 +1,96 @@
+#ifndef CYCOM_DISPLAY_WIDGET_SCROLL_CHART_H_
+#define CYCOM_DISPLAY_WIDGET_SCROLL_CHART_H_
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "display/widget/widget.h"
+
+namespace ui {
+
+/**
+ * @brief 時系列チャートの表示スタイル
+ */
+struct ChartStyle {
+    Color565 fg = Color565::Black();  // 折れ線の色
+    Color565 bg = Color565::White();  // 背景色
+    int line_px = 2;                  // 折れ線の太さ
+    bool horizontal = false;          // true: 時間軸が横（右端が最新）、false: 縦（下端が最新）
+};
+
+/**
+ * @brief 一定間隔で値を記録し、古い順に流れる折れ線で表示するウィジェット
+ *
+ * 1サンプルを時間軸に直交する1ライン（縦の時間軸なら1行、横なら1列）で表し、
+ * 時間軸方向のピクセル数分のサンプルを固定長のリングバッファに保持する。
+ * リングバッファの添字はそのまま領域内のメモリ上のラインに対応する。
+ *
+ * パネルのハードウェアスクロールが時間軸と同じ方向に流れ、領域が時間軸と直交する方向に
+ * 画面の端から端までを占める場合は、新しいサンプルの1ラインだけを描いてスクロール開始
+ * ラインを進める（チャートの長さによらず1サンプルあたり1ライン分の転送）。この場合、
+ * キャンバス上の領域は表示順ではなくメモリ上の並びになる。
+ * それ以外の場合は毎回領域全体を表示順に描き直す。
+ *
+ * 領域に他のウィジェットを重ねないこと（スクロールで一緒に動いてしまう）。
+ */
+class ScrollChart : public Widget {
+public:
+    using ValueSource = std::function<double()>;
+
+    /**
+     * @brief チャートを生成する
+     *
+     * @param bounds 表示領域（時間軸方向のピクセル数がサンプル数になる）
+     * @param source 記録する値を返す関数（NaN は欠測として線を途切れさせる）
+     * @param min_value 左端（横の時間軸では下端）に対応する値
+     * @param max_value 右端（横の時間軸では上端）に対応する値
+     * @param interval 記録間隔
+     * @param style 表示スタイル
+     */
+    ScrollChart(const display::Rect& bounds, ValueSource source, double min_value,
+                double max_value, std::chrono::milliseconds interval, const ChartStyle& style);
+
+    void Update() override;
+    void Invalidate() override;
+
+    /**
+     * @brief 保持できるサンプル数
+     */
+    int Capacity() const { return static_cast<int>(samples_.size()); }
+
+protected:
+    void OnRender(RenderContext& ctx) override;
+
+private:
+    using Clock = std::chrono::steady_clock;
+    static constexpr int16_t kGap = -1;  // 欠測
+
+    void Push(double value);
+    /**
+     * @brief リングバッファの index 番のサンプルを1ライン描く
+     *
+     * @param pos 描画先のライン（領域の先頭からのオフセット）
+     */
+    void DrawSample(display::Framebuffer& canvas, int index, int pos);
+
+    ValueSource source_;
+    double min_;
+    double max_;
+    std::chrono::milliseconds interval_;
+    ChartStyle style_;
+
+    std::vector<int16_t> samples_;  // 値の位置（ピクセル、kGap は欠測）
+    int head_ = 0;     // 次に書き込む添字（満杯時は最も古いサンプル）
+    int count_ = 0;    // 記録済みのサンプル数
+    int unrendered_ = 0;  // 前回の描画以降に追加されたサンプル数
+    bool full_redraw_ = true;
+    Clock::time_point last_sample_;
+    int length_;  // 時間軸と直交する方向のピクセル数（1ラインの長さ）
+    std::vector<uint16_t> line_;  // 1ライン分の作業バッファ
+};
+
+}  // namespace ui
+
+#endif  // CYCOM_DISPLAY_WIDGET_SCROLL_CHART_H_
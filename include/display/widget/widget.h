@@ -0,0 +1,151 @@
+#ifndef CYCOM_DISPLAY_WIDGET_WIDGET_H_
+#define CYCOM_DISPLAY_WIDGET_WIDGET_H_
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include "display/compositor.h"
+#include "display/framebuffer.h"
+#include "display/rect.h"
+#include "display/text_renderer.h"
+
+namespace display {
+class FlushManager;
+}  // namespace display
+
+namespace ui {
+
+/**
+ * @brief ウィジェット描画時に渡す描画先一式
+ */
+struct RenderContext {
+    display::Framebuffer& canvas;            // 描画先（バックバッファ）
+    TextRenderer& text;                      // canvas へ描画するテキストレンダラ
+    display::Compositor* compositor;         // 背景レイヤ（nullptr なら各ウィジェットの背景色で塗る）
+    display::FlushManager* flush = nullptr;  // ハードウェアスクロール等のパネル制御（nullptr なら不使用）
+
+    /**
+     * @brief 領域の背景を用意する（背景レイヤがあれば復元、なければ単色で塗る）
+     */
+    void ClearBackground(const display::Rect& r, Color565 fallback) {
+        if (compositor) {
+            compositor->Restore(r);
+        } else {
+            canvas.FillRect(r, fallback.value);
+        }
+    }
+};
+
+/**
+ * @brief 保持型（リテインドモード）UIの基底クラス
+ * 
+ * 各ウィジェットは表示領域・データソース・ダーティフラグを持つ。
+ * Update() でデータソースを評価し、表示内容が変わったときだけダーティにする。
+ * Render() はダーティなウィジェットだけを描き直すため、値が変わらない限りSPI転送も発生しない。
+ */
+class Widget {
+public:
+    explicit Widget(const display::Rect& bounds) : bounds_(bounds) {}
+    virtual ~Widget() = default;
+
+    Widget(const Widget&) = delete;
+    Widget& operator=(const Widget&) = delete;
+
+    /**
+     * @brief データソースを評価し、表示内容が変われば自身をダーティにする
+     */
+    virtual void Update() = 0;
+
+    /**
+     * @brief 時間とともに変わる表示（トゥイーン等）を now の時点まで進める
+     * 
+     * 表示が変わる場合は自身をダーティにする。既定では何もしない。
+     * 
+     * @param now 現在時刻
+     * @return true まだアニメーション中（次のフレームでも呼んでほしい）
+     * @return false 静止している
+     */
+    virtual bool Animate(std::chrono::steady_clock::time_point /*now*/) { return false; }
+
+    /**
+     * @brief ダーティであれば描画し、ダーティを解除する
+     * 
+     * @param ctx 描画先
+     * @return true 描画した
+     * @return false ダーティでなかった
+     */
+    bool Render(RenderContext& ctx);
+
+    /**
+     * @brief 次回の Render() で必ず描き直させる（差分描画するウィジェットは全体を描き直す）
+     */
+    virtual void Invalidate() { dirty_ = true; }
+
+    bool IsDirty() const { return dirty_; }
+    const display::Rect& Bounds() const { return bounds_; }
+
+protected:
+    /**
+     * @brief 表示領域全体を描画する（派生クラスで実装）
+     */
+    virtual void OnRender(RenderContext& ctx) = 0;
+
+    void MarkDirty() { dirty_ = true; }
+
+private:
+    display::Rect bounds_;
+    bool dirty_ = true;  // 初回は必ず描画する
+};
+
+/**
+ * @brief ウィジェットの所有と一括更新・描画を行うコンテナ
+ */
+class WidgetTree {
+public:
+    /**
+     * @brief ウィジェットを追加する
+     * 
+     * @param widget 追加するウィジェット（所有権を移す）
+     * @return T* 追加したウィジェット（WidgetTree が破棄されるまで有効）
+     */
+    template <typename T>
+    T* Add(std::unique_ptr<T> widget) {
+        T* raw = widget.get();
+        widgets_.push_back(std::move(widget));
+        return raw;
+    }
+
+    /**
+     * @brief 全ウィジェットのデータソースを評価する
+     */
+    void Update();
+
+    /**
+     * @brief 全ウィジェットのアニメーションを進める
+     * 
+     * @param now 現在時刻
+     * @return true アニメーション中のウィジェットがある
+     */
+    bool Animate(std::chrono::steady_clock::time_point now);
+
+    /**
+     * @brief ダーティなウィジェットだけを描画する
+     * 
+     * @param ctx 描画先
+     * @return int 描画したウィジェット数
+     */
+    int Render(RenderContext& ctx);
+
+    /**
+     * @brief 全ウィジェットをダーティにする（画面切り替え時など）
+     */
+    void InvalidateAll();
+
+private:
+    std::vector<std::unique_ptr<Widget>> widgets_;
+};
+
+}  // namespace ui
+
+#endif  // CYCOM_DISPLAY_WIDGET_WIDGET_H_
@@ -0,0 +1,77 @@
+#ifndef CYCOM_DRIVER_IMPL_COMMAND_SEQUENCE_H_
+#define CYCOM_DRIVER_IMPL_COMMAND_SEQUENCE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+namespace driver {
+
+/**
+ * @brief DCピン方式のLCDコントローラ向けコマンド列ビルダ
+ *
+ * コマンドバイトとパラメータを1つの連続バッファに詰め、DCレベルが同じ区間（ラン）ごとに
+ * まとめて保持する。送信側はラン単位で1回のSPI書き込みを行えばよく、
+ * 1バイトごとにDC切り替えと書き込みを行う場合に比べてシステムコール数を大幅に削減できる。
+ *
+ * 連続するパラメータなしコマンドは1つのコマンドランに、連続するデータは1つのデータランに結合される。
+ */
+class CommandSequence {
+public:
+    /**
+     * @brief 送信単位（同一DCレベルの連続バイト列）
+     */
+    struct Run {
+        bool data;      // true=データ(DC High), false=コマンド(DC Low)
+        size_t offset;  // bytes() 内の開始位置
+        size_t len;     // バイト数
+    };
+
+    CommandSequence() = default;
+
+    /**
+     * @brief 予約サイズを指定して構築する（再利用時の再確保を避ける）
+     *
+     * @param reserve_bytes 予約するバイト数
+     */
+    explicit CommandSequence(size_t reserve_bytes);
+
+    /**
+     * @brief コマンドとパラメータを追加する
+     *
+     * @param cmd コマンドバイト
+     * @param params パラメータ列
+     * @return CommandSequence& メソッドチェーン用
+     */
+    CommandSequence& Add(uint8_t cmd, std::initializer_list<uint8_t> params = {});
+
+    /**
+     * @brief コマンドとパラメータを追加する
+     *
+     * @param cmd コマンドバイト
+     * @param params パラメータの先頭ポインタ
+     * @param n パラメータのバイト数
+     * @return CommandSequence& メソッドチェーン用
+     */
+    CommandSequence& Add(uint8_t cmd, const uint8_t* params, size_t n);
+
+    /**
+     * @brief 内容を破棄する（確保済みの容量は保持）
+     */
+    void Clear();
+
+    bool Empty() const { return runs_.empty(); }
+    const uint8_t* bytes() const { return bytes_.data(); }
+    const std::vector<Run>& runs() const { return runs_; }
+
+private:
+    void Append(bool data, const uint8_t* p, size_t n);
+
+    std::vector<uint8_t> bytes_;
+    std::vector<Run> runs_;
+};
+
+}  // namespace driver
+
+#endif  // CYCOM_DRIVER_IMPL_COMMAND_SEQUENCE_H_
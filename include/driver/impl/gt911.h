@@ -2,6 +2,7 @@
 #define CYCOM_DRIVER_IMPL_GT911_H_
 
 #include <cstdint>
+#include "driver/interface/i_display.h"
 #include "driver/interface/i_touch.h"
 #include "hal/interface/i_i2c.h"
 #include "hal/interface/i_gpio.h"
@@ -16,7 +17,7 @@ namespace driver {
  */
 class GT911 : public ITouch {
 public:
-    // 画面サイズ
+    // パネル本来（縦長）の座標範囲
     static constexpr int kCoordinateXMax = 320;
     static constexpr int kCoordinateYMax = 480;
 
@@ -27,8 +28,10 @@ public:
      * @param rst リセットGPIO
      * @param int_pin 割り込みGPIO
      * @param i2c_addr I2Cアドレス (デフォルト: 0x5D)
+     * @param orientation 画面の向き（ディスプレイと同じ向きの論理座標で返す）
      */
-    GT911(hal::II2c* i2c, hal::IGpio* rst, hal::IGpio* int_pin, uint8_t i2c_addr = 0x5D);
+    GT911(hal::II2c* i2c, hal::IGpio* rst, hal::IGpio* int_pin, uint8_t i2c_addr = 0x5D,
+          Orientation orientation = Orientation::kPortrait);
 
     ~GT911() override;
 
@@ -36,6 +39,13 @@ public:
     TouchPoint GetTouchPoint() override;
     bool IsTouched() override;
 
+    /**
+     * @brief 座標を返す向きを変更する
+     * 
+     * @param orientation 画面の向き
+     */
+    void SetOrientation(Orientation orientation) { orientation_ = orientation; }
+
 private:
     void Reset();
     void ConfigureResolution(int x_max, int y_max);
@@ -46,6 +56,7 @@ private:
     hal::IGpio* rst_;
     hal::IGpio* int_pin_;
     uint8_t i2c_addr_;
+    Orientation orientation_;
 
     // GT911レジスタアドレス
     static constexpr uint16_t COMMAND_REG = 0x8040;
@@ -0,0 +1,132 @@
+#ifndef CYCOM_DRIVER_IMPL_PIXEL_FORMAT_H_
+#define CYCOM_DRIVER_IMPL_PIXEL_FORMAT_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "driver/interface/i_display.h"
+#include "util/byte_swap.h"
+
+namespace driver {
+
+/**
+ * @brief SPI転送時のピクセル形式ごとの定数
+ *
+ * kGroupPixels 画素を kGroupBytes バイトに詰める（RGB444 は2画素を3バイト）。
+ */
+template <PixelFormat F>
+struct PixelFormatTraits;
+
+template <>
+struct PixelFormatTraits<PixelFormat::kRGB565> {
+    static constexpr uint8_t kColmod = 0x55;
+    static constexpr size_t kGroupPixels = 1;
+    static constexpr size_t kGroupBytes = 2;
+};
+
+template <>
+struct PixelFormatTraits<PixelFormat::kRGB444> {
+    static constexpr uint8_t kColmod = 0x33;
+    static constexpr size_t kGroupPixels = 2;
+    static constexpr size_t kGroupBytes = 3;
+};
+
+template <>
+struct PixelFormatTraits<PixelFormat::kRGB666> {
+    static constexpr uint8_t kColmod = 0x66;
+    static constexpr size_t kGroupPixels = 1;
+    static constexpr size_t kGroupBytes = 3;
+};
+
+/**
+ * @brief n 画素の転送に必要なバイト数（端数の画素は最後のバイトを埋めずに送る）
+ */
+template <PixelFormat F>
+constexpr size_t PixelBytes(size_t n) {
+    using T = PixelFormatTraits<F>;
+    return (n * T::kGroupBytes + T::kGroupPixels - 1) / T::kGroupPixels;
+}
+
+/**
+ * @brief RGB565 の画素列を転送形式のバイト列へ詰める
+ *
+ * 形式と入力のバイト順ごとに別の関数として展開されるため、ループ内に形式の分岐は残らない。
+ * RGB444 は各色の上位4ビット、RGB666 は各色を6ビットへ拡張して上位に詰める。
+ *
+ * @param src 入力（O のバイト順）
+ * @param n 画素数
+ * @param dst 出力先（PixelBytes<F>(n) バイト）
+ * @return size_t 書き込んだバイト数
+ */
+template <PixelFormat F, PixelOrder O>
+size_t PackPixels(const uint16_t* src, size_t n, uint8_t* dst) {
+    auto load = [src](size_t i) -> uint16_t {
+        return O == PixelOrder::kPanel ? util::Swap16(src[i]) : src[i];
+    };
+    if constexpr (F == PixelFormat::kRGB565) {
+        if constexpr (O == PixelOrder::kPanel) {
+            std::memcpy(dst, src, n * 2);
+        } else {
+            util::SwapBytes16(src, reinterpret_cast<uint16_t*>(dst), n);
+        }
+    } else if constexpr (F == PixelFormat::kRGB444) {
+        // R1G1 B1R2 G2B2
+        auto r4 = [](uint16_t p) { return static_cast<uint8_t>(p >> 12); };
+        auto g4 = [](uint16_t p) { return static_cast<uint8_t>((p >> 7) & 0x0F); };
+        auto b4 = [](uint16_t p) { return static_cast<uint8_t>((p >> 1) & 0x0F); };
+        size_t i = 0;
+        uint8_t* d = dst;
+        for (; i + 2 <= n; i += 2, d += 3) {
+            const uint16_t p0 = load(i), p1 = load(i + 1);
+            d[0] = static_cast<uint8_t>(r4(p0) << 4 | g4(p0));
+            d[1] = static_cast<uint8_t>(b4(p0) << 4 | r4(p1));
+            d[2] = static_cast<uint8_t>(g4(p1) << 4 | b4(p1));
+        }
+        if (i < n) {
+            const uint16_t p = load(i);
+            d[0] = static_cast<uint8_t>(r4(p) << 4 | g4(p));
+            d[1] = static_cast<uint8_t>(b4(p) << 4);
+        }
+    } else {
+        // 5ビットの色は上位ビットを下に複製して6ビットへ広げる
+        for (size_t i = 0; i < n; ++i) {
+            const uint16_t p = load(i);
+            const uint8_t r5 = p >> 11, g6 = (p >> 5) & 0x3F, b5 = p & 0x1F;
+            dst[i * 3 + 0] = static_cast<uint8_t>(((r5 << 1) | (r5 >> 4)) << 2);
+            dst[i * 3 + 1] = static_cast<uint8_t>(g6 << 2);
+            dst[i * 3 + 2] = static_cast<uint8_t>(((b5 << 1) | (b5 >> 4)) << 2);
+        }
+    }
+    return PixelBytes<F>(n);
+}
+
+/**
+ * @brief 単色 n 画素分の転送バイト列を埋める
+ *
+ * @param dst 出力先（PixelBytes<F>(n) バイト）
+ * @param rgb565 ホスト順の色
+ * @param n 画素数
+ */
+template <PixelFormat F>
+void FillPixels(uint8_t* dst, uint16_t rgb565, size_t n) {
+    using T = PixelFormatTraits<F>;
+    const size_t total = PixelBytes<F>(n);
+    if (total == 0) return;
+    // 1グループ分を詰め、既に埋めた領域を倍々でコピーして広げる
+    uint16_t group[T::kGroupPixels];
+    for (uint16_t& p : group) p = rgb565;
+    alignas(uint16_t) uint8_t pattern[T::kGroupBytes];
+    PackPixels<F, PixelOrder::kHost>(group, T::kGroupPixels, pattern);
+    size_t filled = total < T::kGroupBytes ? total : T::kGroupBytes;
+    std::memcpy(dst, pattern, filled);
+    while (filled < total) {
+        const size_t chunk = (filled < total - filled) ? filled : total - filled;
+        std::memcpy(dst + filled, dst, chunk);
+        filled += chunk;
+    }
+}
+
+}  // namespace driver
+
+#endif  // CYCOM_DRIVER_IMPL_PIXEL_FORMAT_H_
@@ -1,11 +1,14 @@
 #ifndef CYCOM_DRIVER_IMPL_ST7796_H_
 #define CYCOM_DRIVER_IMPL_ST7796_H_
 
+#include <chrono>
 #include <cstdint>
 #include <cstddef>
 #include <memory>
 #include <string>
+#include <vector>
 
+#include "driver/impl/command_sequence.h"
 #include "driver/interface/i_display.h"
 #include "hal/interface/i_gpio.h"
 #include "hal/interface/i_spi.h"
@@ -20,9 +23,9 @@ namespace driver {
  */
 class ST7796 : public IDisplay {
 public:
-    // 画面サイズ
-    static constexpr int kWidth = 320;
-    static constexpr int kHeight = 480;
+    // パネル本来（縦長）の画面サイズ
+    static constexpr int kNativeWidth = 320;
+    static constexpr int kNativeHeight = 480;
 
     /**
      * @brief ST7796ディスプレイを初期化する
@@ -31,17 +34,43 @@ public:
      * @param dc データ/コマンド選択GPIO
      * @param rst リセットGPIO
      * @param bl バックライトGPIO
+     * @param orientation 画面の向き（MADCTL で設定するため、描画時の変換コストはない）
+     * @param format SPI転送のピクセル形式（COLMOD）
+     * @param te TE（ティアリングエフェクト）出力を読む入力GPIO（未接続なら nullptr）
      */
-    ST7796(hal::ISpi* spi, hal::IGpio* dc, hal::IGpio* rst, hal::IGpio* bl);
+    ST7796(hal::ISpi* spi, hal::IGpio* dc, hal::IGpio* rst, hal::IGpio* bl,
+           Orientation orientation = Orientation::kPortrait,
+           PixelFormat format = PixelFormat::kRGB565, hal::IGpio* te = nullptr);
 
     ~ST7796() override = default;
 
     // IDisplayインターフェースの実装
     void Clear(uint16_t rgb565 = 0xFFFF) override;
     void DrawRGB565Line(int x, int y, const uint16_t* rgb565, int len) override;
+    void DrawRGB565Rect(int x, int y, int w, int h, const uint16_t* px, int stride_px,
+                        PixelOrder order) override;
     bool DrawBackgroundImage(const std::string& path) override;
-    int GetWidth() const override { return kWidth; }
-    int GetHeight() const override { return kHeight; }
+    int GetWidth() const override { return width_; }
+    int GetHeight() const override { return height_; }
+    bool SetPixelFormat(PixelFormat format) override;
+    PixelFormat GetPixelFormat() const { return pixel_format_; }
+    bool SupportsHardwareScroll() const override { return true; }
+    ScrollAxis GetScrollAxis() const override;
+    void SetScrollArea(int top, int height) override;
+    void SetScrollStart(int line) override;
+    bool SupportsVBlankSync() const override { return te_ != nullptr; }
+    bool WaitForVBlank(std::chrono::microseconds timeout) override;
+
+    /**
+     * @brief 画面の向きを変更する
+     * 
+     * MADCTL の行列交換・反転で回転させ、論理的な幅と高さを入れ替える。
+     * 既にこのパネルの寸法で確保したフレームバッファ等がある場合は作り直すこと。
+     * 
+     * @param orientation 画面の向き
+     */
+    void SetOrientation(Orientation orientation);
+    Orientation GetOrientation() const { return orientation_; }
 
     /**
      * @brief 矩形領域を指定色で塗りつぶす
@@ -57,24 +86,72 @@ public:
     /**
      * @brief RGB565フレームバッファを画面全体に描画する
      * 
-     * @param buf RGB565ピクセルデータ
+     * RGB565 以外の転送形式では、送りながら現在の形式へ変換する。
+     * 
+     * @param buf RGB565ピクセルデータ（パネル転送順、2バイト境界に配置）
      * @param len バイト数
      */
     void BlitRGB565(const uint8_t* buf, size_t len);
 
+    /**
+     * @brief コマンド列をDCレベルのラン単位でまとめて送信する
+     * 
+     * DCピンは現在のレベルと異なる場合のみ切り替える。
+     * 
+     * @param seq 送信するコマンド列
+     */
+    void Send(const CommandSequence& seq);
+
 private:
     void DataMode(bool data);
-    void Cmd(uint8_t c);
-    void Dat(uint8_t d);
     void Reset();
     void SetAddressWindow(int xs, int ys, int xe, int ye);
+    /**
+     * @brief 向きに対応する MADCTL の値を返す
+     */
+    static uint8_t Madctl(Orientation orientation);
+    void UpdateLogicalSize();
     void SendChunked(const uint8_t* data, size_t len);
+    void SendFill(uint16_t rgb565, size_t pixels);
+
+    // 転送形式ごとに展開する描画・塗りつぶし（形式は呼び出し側で分岐する）
+    template <PixelFormat F>
+    void DrawRectAs(int x, int y, int w, int h, const uint16_t* px, int stride_px,
+                    PixelOrder order);
+    template <PixelFormat F>
+    void SendFillAs(uint16_t rgb565, size_t pixels);
+    static uint8_t Colmod(PixelFormat format);
     void Init();
 
     hal::ISpi* spi_;
     hal::IGpio* dc_;
     hal::IGpio* rst_;
     hal::IGpio* bl_;
+    hal::IGpio* te_;  // TE 出力（nullptr=未接続）
+
+    int dc_level_ = -1;  // DCピンの現在レベル（-1=未設定）
+
+    Orientation orientation_;
+    PixelFormat pixel_format_;
+    int width_ = kNativeWidth;    // 論理幅（向きに応じて入れ替わる）
+    int height_ = kNativeHeight;  // 論理高さ
+
+    // アドレスウィンドウ設定用の再利用コマンド列と、直前に送ったウィンドウ
+    CommandSequence window_seq_{16};
+    int win_xs_ = -1, win_xe_ = -1;
+    int win_ys_ = -1, win_ye_ = -1;
+
+    // SPI転送サイズ（spidevのbufsiz、偶数に丸め）と転送用の再利用バッファ
+    size_t chunk_bytes_;
+    std::vector<uint8_t> tx_buf_;
+    std::vector<uint8_t> fill_buf_;
+    int fill_color_ = -1;  // fill_buf_ に展開済みの色（-1=未展開。形式を変えたら展開し直す）
+    std::vector<uint16_t> stage_;  // 複数画素を1グループに詰める形式用の行またぎの画素
+
+    // 直前に送った縦スクロール設定（論理ライン、-1=未設定）
+    int scroll_top_ = -1, scroll_height_ = -1;
+    int scroll_start_ = -1;
+    CommandSequence scroll_seq_{16};
 };
 
 }  // namespace driver
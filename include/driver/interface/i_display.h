@@ -1,11 +1,62 @@
 #ifndef CYCOM_DRIVER_INTERFACE_I_DISPLAY_H_
 #define CYCOM_DRIVER_INTERFACE_I_DISPLAY_H_
 
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <string>
 
 namespace driver {
 
+/**
+ * @brief RGB565ピクセル配列のバイト順
+ */
+enum class PixelOrder {
+    kHost,   // ホストのネイティブ順（uint16_tの値がそのままRGB565）
+    kPanel,  // パネル転送順（メモリ上で上位バイトが先＝ビッグエンディアン）
+};
+
+/**
+ * @brief パネルへ転送するピクセル形式（描画側は常に RGB565 で扱い、転送時に変換する）
+ */
+enum class PixelFormat {
+    kRGB565,  // 16ビット（2バイト/画素）
+    kRGB444,  // 12ビット（2画素を3バイト。RGB565 より転送量が25%少ない）
+    kRGB666,  // 18ビット（3バイト/画素。階調重視の画面向け）
+};
+
+/**
+ * @brief n 画素を1回の書き込みで送るときのバイト数
+ */
+constexpr size_t TransferBytes(PixelFormat format, size_t n) {
+    switch (format) {
+    case PixelFormat::kRGB444: return (n * 3 + 1) / 2;
+    case PixelFormat::kRGB666: return n * 3;
+    case PixelFormat::kRGB565:
+    default: return n * 2;
+    }
+}
+
+/**
+ * @brief 画面の向き（パネル本来の縦長の向きからの回転）
+ * 
+ * 値は CMake の CYCOM_DISPLAY_ORIENTATION の並びと一致させる。
+ */
+enum class Orientation {
+    kPortrait = 0,          // 縦長（パネル本来の向き）
+    kLandscape = 1,         // 横長（90度回転）
+    kPortraitFlipped = 2,   // 縦長（180度回転）
+    kLandscapeFlipped = 3,  // 横長（270度回転）
+};
+
+/**
+ * @brief ハードウェアスクロールで表示が流れる方向
+ */
+enum class ScrollAxis {
+    kRows,     // 行単位（上下に流れる）
+    kColumns,  // 列単位（左右に流れる）
+};
+
 /**
  * @brief ディスプレイドライバの抽象インターフェース
  * 
@@ -33,6 +84,22 @@ public:
      */
     virtual void DrawRGB565Line(int x, int y, const uint16_t* rgb565, int len) = 0;
 
+    /**
+     * @brief 矩形領域にRGB565ピクセルデータを描画する
+     * 
+     * order が kPanel の場合はバイト入れ替えを行わずにそのまま転送する。
+     * 
+     * @param x 開始X座標
+     * @param y 開始Y座標
+     * @param w 幅（ピクセル）
+     * @param h 高さ（ピクセル）
+     * @param px ピクセルデータの先頭
+     * @param stride_px 1行あたりのピクセル数（w 以上）
+     * @param order ピクセルデータのバイト順
+     */
+    virtual void DrawRGB565Rect(int x, int y, int w, int h, const uint16_t* px, int stride_px,
+                                PixelOrder order) = 0;
+
     /**
      * @brief 背景画像を描画する
      * 
@@ -55,6 +122,63 @@ public:
      * @return int 画面高さ（ピクセル）
      */
     virtual int GetHeight() const = 0;
+
+    /**
+     * @brief パネルへ転送するピクセル形式を変更する
+     * 
+     * 描画関数に渡すピクセルは形式によらず RGB565 のまま。表示済みの内容は変わらない。
+     * 
+     * @param format ピクセル形式
+     * @return true 変更した
+     * @return false 対応していない形式
+     */
+    virtual bool SetPixelFormat(PixelFormat format) { return format == PixelFormat::kRGB565; }
+
+    /**
+     * @brief ハードウェアスクロールに対応しているか
+     * 
+     * 対応していれば SetScrollArea() / SetScrollStart() で表示上のラインの並びを変えられる。
+     * ラインは GetScrollAxis() が kRows なら行、kColumns なら列を指す。
+     * 描画座標（メモリ上のライン）はスクロールの影響を受けない。
+     */
+    virtual bool SupportsHardwareScroll() const { return false; }
+
+    /**
+     * @brief ハードウェアスクロールの方向を取得する
+     */
+    virtual ScrollAxis GetScrollAxis() const { return ScrollAxis::kRows; }
+
+    /**
+     * @brief スクロール領域を設定する（領域外のラインは固定表示）
+     * 
+     * @param top 領域の先頭ライン
+     * @param height 領域のライン数
+     */
+    virtual void SetScrollArea(int /*top*/, int /*height*/) {}
+
+    /**
+     * @brief スクロール領域の先頭に表示するメモリ上のラインを設定する
+     * 
+     * @param line メモリ上のライン（top 以上 top + height 未満）
+     */
+    virtual void SetScrollStart(int /*line*/) {}
+
+    /**
+     * @brief 垂直ブランキングの開始を検出できるか（パネルの TE 出力を読めるか）
+     */
+    virtual bool SupportsVBlankSync() const { return false; }
+
+    /**
+     * @brief 次の垂直ブランキングの開始を待つ
+     * 
+     * 戻った直後に転送を始めると、パネルの走査と書き込みが同じ領域で交差しにくくなる
+     * （1走査周期内に送り切れる更新ならティアリングは起きない）。
+     * 
+     * @param timeout タイムアウト時間
+     * @return true 垂直ブランキングの開始を検出した
+     * @return false タイムアウトした、または検出できない
+     */
+    virtual bool WaitForVBlank(std::chrono::microseconds /*timeout*/) { return false; }
 };
 
 }  // namespace driver
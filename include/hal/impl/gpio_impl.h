@@ -53,6 +53,7 @@ public:
     void RequestRisingEdge() override;
     void RequestFallingEdge() override;
     bool WaitForEvent(int timeout_sec) override;
+    bool WaitForEdge(std::chrono::microseconds timeout) override;
 
     /**
      * @brief GPIOイベントを読み取る（libgpiod固有の機能）
@@ -40,9 +40,18 @@ public:
     void WriteBytes(const uint8_t* data, size_t len) override;
     void ReadBytes(uint8_t* buffer, size_t len) override;
     void Transfer(const uint8_t* tx_data, uint8_t* rx_buffer, size_t len) override;
+    size_t MaxTransferSize() const override { return max_transfer_; }
 
 private:
+    /**
+     * @brief spidevモジュールのbufsizパラメータを読み取る
+     * 
+     * @return size_t 1メッセージの最大バイト数（読めない場合は既定値4096）
+     */
+    static size_t ReadSpidevBufsiz();
+
     int fd_;
+    size_t max_transfer_;
 };
 
 }  // namespace hal
@@ -1,6 +1,7 @@
 #ifndef CYCOM_HAL_INTERFACE_I_GPIO_H_
 #define CYCOM_HAL_INTERFACE_I_GPIO_H_
 
+#include <chrono>
 #include <ctime>
 
 namespace hal {
@@ -47,6 +48,19 @@ public:
      * @return false タイムアウトした
      */
     virtual bool WaitForEvent(int timeout_sec) = 0;
+
+    /**
+     * @brief 次のエッジを待つ（エッジを起点に処理を始めたい周期信号向け）
+     * 
+     * 呼び出し時点で検出済みのイベントは過去のエッジとして読み捨て、
+     * 呼び出し後に発生したエッジだけを待つ。発生したイベントは読み取り済みになる。
+     * 事前に RequestRisingEdge() / RequestFallingEdge() で検出を有効化しておくこと。
+     * 
+     * @param timeout タイムアウト時間
+     * @return true エッジが発生した
+     * @return false タイムアウトした
+     */
+    virtual bool WaitForEdge(std::chrono::microseconds timeout) = 0;
 };
 
 }  // namespace hal
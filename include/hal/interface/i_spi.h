@@ -40,6 +40,13 @@ public:
      * @param len 送受信するバイト数
      */
     virtual void Transfer(const uint8_t* tx_data, uint8_t* rx_buffer, size_t len) = 0;
+
+    /**
+     * @brief 1回の書き込みで送信できる最大バイト数を取得する
+     * 
+     * @return size_t 最大転送バイト数
+     */
+    virtual size_t MaxTransferSize() const = 0;
 };
 
 }  // namespace hal
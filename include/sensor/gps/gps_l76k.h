@@ -5,6 +5,8 @@
 #include <mutex>
 #include <limits>
 
+#include "util/update_notifier.h"
+
 #ifndef GPS_L76K_H
 #define GPS_L76K_H
 
@@ -122,6 +124,16 @@ namespace sensor{
 
             void ProcessNmeaLine(const std::string &line);
 
+            /**
+             * @brief エポック（RMC・GGA・VTG の組）を受信し終えるたびに通知する先を設定する
+             *
+             * 3つの文が揃った時点で1回だけ通知する。文が欠けたエポックは、次のエポックの
+             * 最初の文（同じ種類の文の再受信、または UTC 時刻の変化）で検出して通知する。
+             *
+             * @param[in] notifier 通知先（nullptr で通知しない）
+             */
+            void SetNotifier(util::UpdateNotifier* notifier);
+
             GnssSnapshot Snapshot() const;
 
             double GetGnvtgSpeed();
@@ -131,6 +143,24 @@ namespace sensor{
             GNRMC gnrmc_data_{};
             GNGGA gngga_data_{};
             GNVTG gnvtg_data_{};
+            util::UpdateNotifier* notifier_{nullptr};
+
+            // 受信中のエポック（ProcessNmeaLine を呼ぶ受信スレッドのみが使う）
+            static constexpr uint8_t kEpochRmc = 1 << 0;
+            static constexpr uint8_t kEpochGga = 1 << 1;
+            static constexpr uint8_t kEpochVtg = 1 << 2;
+            static constexpr uint8_t kEpochComplete = kEpochRmc | kEpochGga | kEpochVtg;
+            uint8_t epoch_seen_ = 0;        // 受信済みの文
+            bool epoch_notified_ = false;   // このエポックを通知済みか
+            double epoch_utc_ = std::numeric_limits<double>::quiet_NaN();  // 0時からの秒
+
+            /**
+             * @brief 受信した文をエポックに加え、エポックの区切りで表示側へ通知する
+             *
+             * @param[in] sentence kEpochRmc / kEpochGga / kEpochVtg
+             * @param[in] utc_sec 文の UTC 時刻（0時からの秒。時刻のない文・無効な時刻は NaN）
+             */
+            void TrackEpoch(uint8_t sentence, double utc_sec);
 
             std::vector<std::string> SplitString(const std::string &line);
 
@@ -0,0 +1,95 @@
+#ifndef CYCOM_UTIL_ASSET_PACK_H_
+#define CYCOM_UTIL_ASSET_PACK_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "util/mapped_file.h"
+
+namespace util {
+
+/**
+ * @brief アセットパックのファイル形式（リトルエンディアン）
+ * 
+ * [AssetPackHeader][AssetEntry × count][データ...]
+ * 各データの先頭は kAssetAlign バイト境界に揃える。
+ */
+constexpr char kAssetPackMagic[4] = {'C', 'Y', 'A', 'P'};
+constexpr uint32_t kAssetPackVersion = 1;
+constexpr size_t kAssetAlign = 16;
+constexpr size_t kAssetNameLen = 48;
+
+enum class AssetType : uint32_t {
+    kBlob = 0,            // 任意のバイナリ
+    kImageRGB565Panel = 1,  // パネル転送順（ビッグエンディアン）RGB565、width * height 画素
+    kFont = 2,            // TrueType / OpenType フォントファイル
+};
+
+struct AssetPackHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t count;
+    uint32_t reserved;
+};
+
+struct AssetEntry {
+    char name[kAssetNameLen];  // NUL終端のアセット名（元ファイル名）
+    AssetType type;
+    uint32_t width;   // 画像のみ
+    uint32_t height;  // 画像のみ
+    uint32_t reserved;
+    uint64_t offset;  // ファイル先頭からのオフセット
+    uint64_t size;    // バイト数
+};
+
+static_assert(sizeof(AssetPackHeader) == 16, "AssetPackHeader layout");
+static_assert(sizeof(AssetEntry) == 80, "AssetEntry layout");
+
+/**
+ * @brief アセットパック内の1要素への参照（データはマップ領域を直接指す）
+ */
+struct Asset {
+    AssetType type;
+    int width;
+    int height;
+    const uint8_t* data;
+    size_t size;
+};
+
+/**
+ * @brief ビルド時に生成したアセットパックをメモリマップして参照するクラス
+ * 
+ * 画像は起動時のデコードや拡大縮小なしでそのままパネルへ送れる形で格納されている。
+ * 開けない・形式が不正な場合は例外を投げず、Find() が常に nullptr を返す。
+ */
+class AssetPack {
+public:
+    /**
+     * @brief アセットパックを開く
+     * 
+     * @param path アセットパックのパス
+     */
+    explicit AssetPack(const std::string& path);
+
+    bool IsOpen() const { return entries_ != nullptr; }
+
+    /**
+     * @brief 名前でアセットを検索する
+     * 
+     * @param name アセット名（例: "measure.jpg"）
+     * @param out 見つかったアセット
+     * @return true 見つかった
+     * @return false 見つからない
+     */
+    bool Find(const std::string& name, Asset& out) const;
+
+private:
+    MappedFile file_;
+    const AssetEntry* entries_ = nullptr;
+    uint32_t count_ = 0;
+};
+
+}  // namespace util
+
+#endif  // CYCOM_UTIL_ASSET_PACK_H_
@@ -0,0 +1,63 @@
+#ifndef CYCOM_UTIL_BLEND565_H_
+#define CYCOM_UTIL_BLEND565_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace util {
+
+/**
+ * @brief 0〜63*255 の整数を255で割った商（切り捨て）を除算なしで求める
+ * 
+ * (v + 1 + (v >> 8)) >> 8 は 0 <= v <= 16065 の全範囲で floor(v / 255) と一致する。
+ */
+constexpr uint32_t Div255(uint32_t v) {
+    return (v + 1 + (v >> 8)) >> 8;
+}
+
+/**
+ * @brief RGB565の1画素をαで合成する（スカラー基準実装）
+ * 
+ * 各チャンネルを (fg * a + bg * (255 - a)) / 255 の切り捨てで求める。
+ * ベクトル版の Blend565Span / Blend565Over はこれとビット単位で一致する。
+ * 
+ * @param bg 背景色
+ * @param fg 前景色
+ * @param a 前景の不透明度（0〜255）
+ * @return uint16_t 合成結果
+ */
+constexpr uint16_t Blend565(uint16_t bg, uint16_t fg, uint8_t a) {
+    const uint32_t inv = 255u - a;
+    const uint32_t r = Div255((fg >> 11) * a + (bg >> 11) * inv);
+    const uint32_t g = Div255(((fg >> 5) & 0x3F) * a + ((bg >> 5) & 0x3F) * inv);
+    const uint32_t b = Div255((fg & 0x1F) * a + (bg & 0x1F) * inv);
+    return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+}
+
+/**
+ * @brief αの並びを単色の背景・前景で合成する
+ * 
+ * NEON / AVX2 / SSE2 が使える場合はベクトル命令で処理し、端数はスカラーで処理する。
+ * 
+ * @param alpha 前景の不透明度の配列
+ * @param fg 前景色
+ * @param bg 背景色
+ * @param dst 出力先（ホスト順RGB565）
+ * @param n 画素数
+ */
+void Blend565Span(const uint8_t* alpha, uint16_t fg, uint16_t bg, uint16_t* dst, size_t n);
+
+/**
+ * @brief αの並びを背景画素の並びの上に合成する
+ * 
+ * @param alpha 前景の不透明度の配列
+ * @param fg 前景色
+ * @param bg 背景画素（ホスト順RGB565。dst と同じ領域でもよい）
+ * @param dst 出力先（ホスト順RGB565）
+ * @param n 画素数
+ */
+void Blend565Over(const uint8_t* alpha, uint16_t fg, const uint16_t* bg, uint16_t* dst, size_t n);
+
+}  // namespace util
+
+#endif  // CYCOM_UTIL_BLEND565_H_
@@ -0,0 +1,40 @@
+#ifndef CYCOM_UTIL_BYTE_SWAP_H_
+#define CYCOM_UTIL_BYTE_SWAP_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace util {
+
+/**
+ * @brief 16ビット値の上位/下位バイトを入れ替える
+ */
+constexpr uint16_t Swap16(uint16_t v) {
+    return static_cast<uint16_t>((v << 8) | (v >> 8));
+}
+
+/**
+ * @brief 16ビット配列のバイト順を入れ替えてコピーする
+ * 
+ * ホスト順のRGB565をパネル転送順（ビッグエンディアン）へ変換する用途を想定。
+ * NEON / SSE2 が使える環境ではベクトル化した経路を使い、それ以外はスカラで処理する。
+ * src と dst は同一でもよい（部分的な重なりは不可）。
+ * 
+ * @param src 入力配列
+ * @param dst 出力配列
+ * @param n 要素数
+ */
+void SwapBytes16(const uint16_t* src, uint16_t* dst, size_t n);
+
+/**
+ * @brief 16ビット値 v を n 個、パネル転送順のバイト列として埋める
+ * 
+ * @param dst 出力先（2*n バイト）
+ * @param v ホスト順の値
+ * @param n 要素数
+ */
+void FillSwapped16(uint8_t* dst, uint16_t v, size_t n);
+
+}  // namespace util
+
+#endif  // CYCOM_UTIL_BYTE_SWAP_H_
@@ -0,0 +1,43 @@
+#ifndef CYCOM_UTIL_IMAGE_LOADER_H_
+#define CYCOM_UTIL_IMAGE_LOADER_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "util/image_scaler.h"
+
+namespace util {
+
+/**
+ * @brief 画像ファイルをデコードし、指定サイズのRGB565（ホスト順）へ変換する
+ * 
+ * アスペクト比を保ったまま出力サイズを覆うように拡大縮小し、はみ出した部分は中央基準で切り取る。
+ * 背景画像向けの既定設定（双線形補間・ディザあり・共有ワーカープールで並列化）を使う。
+ * 
+ * @param path 画像ファイルのパス（JPEG/PNG等、stb_imageが扱える形式）
+ * @param dst_w 出力幅
+ * @param dst_h 出力高さ
+ * @param out 出力先（dst_w * dst_h 要素にリサイズされる）
+ * @return true 成功
+ * @return false 読み込み失敗
+ */
+bool LoadImageRGB565(const std::string& path, int dst_w, int dst_h, std::vector<uint16_t>& out);
+
+/**
+ * @brief 拡大縮小オプションを指定して画像ファイルをRGB565（ホスト順）へ変換する
+ * 
+ * @param path 画像ファイルのパス
+ * @param dst_w 出力幅
+ * @param dst_h 出力高さ
+ * @param out 出力先（dst_w * dst_h 要素にリサイズされる）
+ * @param opt 拡大縮小オプション
+ * @return true 成功
+ * @return false 読み込み失敗
+ */
+bool LoadImageRGB565(const std::string& path, int dst_w, int dst_h, std::vector<uint16_t>& out,
+                     const ScaleOptions& opt);
+
+}  // namespace util
+
+#endif  // CYCOM_UTIL_IMAGE_LOADER_H_
@@ -0,0 +1,63 @@
+#ifndef CYCOM_UTIL_IMAGE_SCALER_H_
+#define CYCOM_UTIL_IMAGE_SCALER_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace util {
+
+class WorkerPool;
+
+/**
+ * @brief 拡大縮小時の画素補間方法
+ */
+enum class ScaleFilter {
+    kNearest,   // 最近傍（最速）
+    kBilinear,  // 双線形補間（縮小・拡大時のジャギーを抑える）
+};
+
+/**
+ * @brief 画像拡大縮小のオプション
+ */
+struct ScaleOptions {
+    ScaleFilter filter = ScaleFilter::kNearest;
+    bool dither = false;         // 4x4 Bayer 配列による組織的ディザでRGB565の階調段差を抑える
+    WorkerPool* pool = nullptr;  // 行帯ごとの並列処理に使うプール（nullptrなら呼び出しスレッドのみ）
+};
+
+/**
+ * @brief 8bit RGB画像を、アスペクト比を保ったまま出力サイズを覆うように拡大縮小してRGB565へ変換する
+ * 
+ * はみ出した部分は中央基準で切り取る。出力画素ごとの参照元座標はあらかじめ整数（16.16固定小数点）の
+ * テーブルに求めておき、1行ぶんをチャンネル別の作業バッファへ集めてからSIMDでまとめてRGB565へ変換する。
+ * 
+ * @param src 入力画素（RGB または RGBA、行間の詰め物なし）
+ * @param src_w 入力幅
+ * @param src_h 入力高さ
+ * @param channels 1画素あたりのバイト数（3 または 4。4番目は無視する）
+ * @param dst 出力先（ホスト順RGB565）
+ * @param dst_w 出力幅
+ * @param dst_h 出力高さ
+ * @param dst_stride 出力の1行あたりの画素数
+ * @param opt オプション
+ */
+void ScaleToRGB565(const uint8_t* src, int src_w, int src_h, int channels,
+                   uint16_t* dst, int dst_w, int dst_h, int dst_stride,
+                   const ScaleOptions& opt = {});
+
+/**
+ * @brief チャンネル別に並んだ8bit RGBをRGB565（ホスト順）へ変換する
+ * 
+ * NEON / AVX2 / SSE2 が使える場合はベクトル命令で変換し、端数はスカラーで処理する。
+ * 
+ * @param r 赤成分の配列
+ * @param g 緑成分の配列
+ * @param b 青成分の配列
+ * @param dst 出力先
+ * @param n 画素数
+ */
+void PackRGB565(const uint8_t* r, const uint8_t* g, const uint8_t* b, uint16_t* dst, size_t n);
+
+}  // namespace util
+
+#endif  // CYCOM_UTIL_IMAGE_SCALER_H_
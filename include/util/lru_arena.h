@@ -0,0 +1,112 @@
+#ifndef CYCOM_UTIL_LRU_ARENA_H_
+#define CYCOM_UTIL_LRU_ARENA_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <unordered_map>
+
+namespace util {
+
+/**
+ * @brief バイト予算つきの連続領域キャッシュ（LRU追い出し）
+ * 
+ * 64bitキーごとに可変長のバイト列を1つの連続バッファ（アリーナ）へ詰めて保持する。
+ * 末尾に空きがなくなると、最も長く使われていないエントリから予算の3/4以下になるまで追い出し、
+ * 生き残ったエントリを先頭へ詰め直す。個別の new / delete は発生しない。
+ * 
+ * Find() / Insert() が返すポインタは、次に Insert() / Clear() / SetBudget() を呼ぶまで有効。
+ * スレッドセーフではない。
+ */
+class LruArena {
+public:
+    // 各エントリの先頭アドレスはこの境界に揃える
+    static constexpr size_t kAlign = 8;
+
+    /**
+     * @brief ヒット率とメモリ使用量の統計
+     */
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
+        size_t entries = 0;
+        size_t bytes_used = 0;    // 生存エントリの合計（アライメント込み）
+        size_t budget_bytes = 0;  // アリーナの容量
+    };
+
+    /**
+     * @brief 指定容量のアリーナを確保する
+     * 
+     * @param budget_bytes 使用できる最大バイト数
+     */
+    explicit LruArena(size_t budget_bytes);
+
+    LruArena(const LruArena&) = delete;
+    LruArena& operator=(const LruArena&) = delete;
+
+    /**
+     * @brief キーに対応するデータを探し、最近使用したものとして記録する
+     * 
+     * @param key キー
+     * @param size 見つかった場合にデータのバイト数を格納する（nullptr 可）
+     * @return uint8_t* データの先頭（見つからなければ nullptr）
+     */
+    uint8_t* Find(uint64_t key, size_t* size = nullptr);
+
+    /**
+     * @brief キーに対する領域を確保する（既存のエントリは置き換える）
+     * 
+     * 必要なら古いエントリを追い出す。呼び出し側は返った領域へデータを書き込む。
+     * 
+     * @param key キー
+     * @param size 確保するバイト数
+     * @return uint8_t* 確保した領域（容量を超える場合は nullptr）
+     */
+    uint8_t* Insert(uint64_t key, size_t size);
+
+    /**
+     * @brief 全エントリを破棄する（統計のヒット・ミス数は保持）
+     */
+    void Clear();
+
+    /**
+     * @brief 容量を変更する（全エントリを破棄する）
+     * 
+     * @param budget_bytes 使用できる最大バイト数
+     */
+    void SetBudget(size_t budget_bytes);
+
+    Stats GetStats() const;
+
+private:
+    struct Entry {
+        size_t offset;
+        size_t size;  // 要求バイト数
+        std::list<uint64_t>::iterator lru;
+    };
+
+    static size_t AlignUp(size_t n) { return (n + kAlign - 1) & ~(kAlign - 1); }
+
+    void Erase(std::unordered_map<uint64_t, Entry>::iterator it);
+
+    /**
+     * @brief need バイトが末尾に入るよう追い出しと詰め直しを行う
+     */
+    void MakeRoom(size_t need);
+
+    std::unique_ptr<uint8_t[]> buf_;
+    size_t budget_ = 0;
+    size_t top_ = 0;   // 次の割り当て位置
+    size_t used_ = 0;  // 生存エントリの合計
+    std::unordered_map<uint64_t, Entry> entries_;
+    std::list<uint64_t> lru_;  // 先頭が最近使用したもの
+    uint64_t hits_ = 0;
+    uint64_t misses_ = 0;
+    uint64_t evictions_ = 0;
+};
+
+}  // namespace util
+
+#endif  // CYCOM_UTIL_LRU_ARENA_H_
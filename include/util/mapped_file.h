@@ -0,0 +1,47 @@
+#ifndef CYCOM_UTIL_MAPPED_FILE_H_
+#define CYCOM_UTIL_MAPPED_FILE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace util {
+
+/**
+ * @brief 読み取り専用でメモリマップしたファイル
+ * 
+ * ファイルを開けない場合は例外を投げず、IsOpen() が false になる。
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+
+    /**
+     * @brief ファイルを読み取り専用でマップする
+     * 
+     * @param path ファイルパス
+     */
+    explicit MappedFile(const std::string& path);
+
+    // コピー禁止、ムーブのみ許可
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    ~MappedFile();
+
+    bool IsOpen() const { return data_ != nullptr; }
+    const uint8_t* Data() const { return data_; }
+    size_t Size() const { return size_; }
+
+private:
+    void Unmap();
+
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+}  // namespace util
+
+#endif  // CYCOM_UTIL_MAPPED_FILE_H_
@@ -0,0 +1,63 @@
+#ifndef CYCOM_UTIL_UPDATE_NOTIFIER_H_
+#define CYCOM_UTIL_UPDATE_NOTIFIER_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+namespace util {
+
+/**
+ * @brief データ更新通知の種類（ビットフラグ）
+ */
+enum UpdateEvent : uint32_t {
+    kUpdateGnss = 1u << 0,       // 新しいGNSSエポック（RMC・GGA・VTG の組）を受信した
+    kUpdateTripStats = 1u << 1,  // 走行統計が変化した
+    kUpdateTouch = 1u << 2,      // タッチ状態が変化した
+    kUpdateSwipeLeft = 1u << 3,  // 左へスワイプした（次のページへ）
+    kUpdateSwipeRight = 1u << 4, // 右へスワイプした（前のページへ）
+    kUpdateWakeup = 1u << 31,    // 待機中のスレッドを起こすだけ（停止要求など）
+};
+
+/**
+ * @brief 複数スレッドからの更新通知を1つの待機点にまとめるクラス
+ * 
+ * 通知側は Notify() でイベントビットを立て、待機側は WaitUntil() でいずれかのビットが
+ * 立つか期限が来るまで眠る。待機していない間に届いた通知はビットとして蓄積され、取りこぼさない。
+ */
+class UpdateNotifier {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief イベントを通知し、待機中のスレッドを起こす
+     * 
+     * @param events UpdateEvent のビット和
+     */
+    void Notify(uint32_t events);
+
+    /**
+     * @brief イベントが届くか期限が来るまで待ち、溜まっていたイベントを取り出す
+     * 
+     * @param deadline 待機期限
+     * @return uint32_t 取り出したイベント（期限切れの場合は0）
+     */
+    uint32_t WaitUntil(Clock::time_point deadline);
+
+    /**
+     * @brief 待たずに溜まっているイベントを取り出す
+     * 
+     * @return uint32_t 取り出したイベント（なければ0）
+     */
+    uint32_t Take();
+
+private:
+    std::mutex mtx_;
+    std::condition_variable cv_;
+    uint32_t pending_ = 0;
+};
+
+}  // namespace util
+
+#endif  // CYCOM_UTIL_UPDATE_NOTIFIER_H_
@@ -0,0 +1,84 @@
+#ifndef CYCOM_UTIL_WORKER_POOL_H_
+#define CYCOM_UTIL_WORKER_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace util {
+
+/**
+ * @brief 固定数のワーカースレッドで処理を分割実行するプール
+ * 
+ * コンストラクタでワーカースレッドを起動し、デストラクタで安全に停止する。
+ * ParallelFor() は呼び出しスレッドも処理に参加し、全タスクの完了まで戻らない。
+ */
+class WorkerPool {
+public:
+    /**
+     * @brief ワーカースレッドを起動する
+     * 
+     * @param workers ワーカースレッド数（0 なら呼び出しスレッドのみで処理）
+     */
+    explicit WorkerPool(unsigned workers);
+
+    /**
+     * @brief ワーカースレッドを安全に停止させる
+     */
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    /**
+     * @brief task(0) 〜 task(count-1) を並列に実行し、全て終わるまで待つ
+     * 
+     * 同時に呼べるのは1スレッドのみ（内部で直列化する）。
+     * 
+     * @param count タスク数
+     * @param task タスク番号を受け取る処理
+     */
+    void ParallelFor(int count, const std::function<void(int)>& task);
+
+    /**
+     * @brief 並列度（ワーカー数 + 呼び出しスレッド）を取得する
+     */
+    int Concurrency() const { return static_cast<int>(threads_.size()) + 1; }
+
+    /**
+     * @brief CPUコア数に合わせた共有プールを取得する（初回呼び出し時に生成）
+     */
+    static WorkerPool& Shared();
+
+private:
+    void WorkerLoop();
+
+    /**
+     * @brief generation 回目の呼び出しのタスクを取れるだけ取って実行する
+     *
+     * task と count は mtx_ の下で読んだ値を渡す。別の呼び出しに切り替わっていれば何もしない。
+     */
+    void RunTasks(const std::function<void(int)>& task, int count, uint32_t generation);
+
+    std::vector<std::thread> threads_;
+    std::mutex call_mtx_;  // ParallelFor() の直列化
+
+    std::mutex mtx_;
+    std::condition_variable cv_;
+    std::condition_variable done_cv_;
+    const std::function<void(int)>* task_ = nullptr;
+    int count_ = 0;
+    // 上位32ビットが世代、下位32ビットが次に取るタスク番号（古い世代のワーカーが取らないよう一緒に比較する）
+    std::atomic<uint64_t> next_{0};
+    int remaining_ = 0;     // 未完了のタスク数
+    uint32_t generation_ = 0;
+    bool running_ = true;
+};
+
+}  // namespace util
+
+#endif  // CYCOM_UTIL_WORKER_POOL_H_
@@ -24,11 +24,20 @@
 #include "sensor/gps/gps_l76k.h"
 #include "sensor/sensor_manager.h"
 #include "util/logger.h"
+#include "util/update_notifier.h"
 #include "display/display_manager.h"
 #include "display/touch/touch_manager.h"
 
+// 画面の向き（CMake の CYCOM_DISPLAY_ORIENTATION で指定。未指定なら縦長）
+#ifndef CYCOM_DISPLAY_ORIENTATION
+#define CYCOM_DISPLAY_ORIENTATION 0
+#endif
+
 namespace {
     std::atomic<bool> g_shutdown_requested{false};
+
+    constexpr driver::Orientation kOrientation =
+        static_cast<driver::Orientation>(CYCOM_DISPLAY_ORIENTATION);
     
     void SignalHandler(int signal) {
         if (signal == SIGINT || signal == SIGTERM) {
@@ -52,6 +61,8 @@ int main() {
     std::unique_ptr<hal::GpioImpl> display_dc = std::make_unique<hal::GpioImpl>("gpiochip0", 22, true, 1);
     std::unique_ptr<hal::GpioImpl> display_rst = std::make_unique<hal::GpioImpl>("gpiochip0", 27, true, 1);
     std::unique_ptr<hal::GpioImpl> display_bl = std::make_unique<hal::GpioImpl>("gpiochip0", 18, true, 1);
+    // TE（垂直ブランキング）入力: 転送開始をパネルの走査に合わせる
+    std::unique_ptr<hal::GpioImpl> display_te = std::make_unique<hal::GpioImpl>("gpiochip0", 17, false);
     
     // SPI: ディスプレイ通信用
     std::unique_ptr<hal::SpiImpl> spi = std::make_unique<hal::SpiImpl>("/dev/spidev0.0", 40000000, 0, 8);
@@ -76,24 +87,32 @@ int main() {
     // ドライバ層のインスタンス生成（HAL層を注入）
     // ========================================
     
-    // ディスプレイドライバ
+    // ディスプレイドライバ（向きは MADCTL で設定し、描画側は論理座標のまま扱う）
     std::unique_ptr<driver::ST7796> display = std::make_unique<driver::ST7796>(
         spi.get(),
         display_dc.get(),
         display_rst.get(),
-        display_bl.get()
+        display_bl.get(),
+        kOrientation,
+        driver::PixelFormat::kRGB565,
+        display_te.get()
     );
     
-    // タッチドライバ（スレッドなし、同期的なインターフェース）
+    // タッチドライバ（スレッドなし、同期的なインターフェース。座標はディスプレイと同じ向き）
     std::unique_ptr<driver::GT911> touch = std::make_unique<driver::GT911>(
         i2c.get(),
         touch_rst.get(),
         touch_int.get(),
-        gt911_addr
+        gt911_addr,
+        kOrientation
     );
     
+    // 表示更新の通知（GPS・タッチ → Displayスレッド）
+    util::UpdateNotifier display_updates;
+
     // GPSドライバ（既存実装を使用）
     sensor::L76k gps;
+    gps.SetNotifier(&display_updates);
     
     // ====================================
     // アプリケーション層
@@ -106,10 +125,10 @@ int main() {
     sensor::SensorManager sensor_manager(uart_fd, gps);
     
     // ディスプレイマネージャー（Displayスレッドを起動）
-    display::DisplayManager display_manager(*display, gps);
+    display::DisplayManager display_manager(config_path, *display, gps, display_updates);
     
     // タッチマネージャー（Touchスレッドを起動）
-    display::TouchManager touch_manager(*touch);
+    display::TouchManager touch_manager(*touch, &display_updates);
 
     // ========================================
     // メインループ（終了シグナル待機のみ）
@@ -118,7 +137,8 @@ int main() {
     // 各スレッドの役割:
     // - Sensorスレッド:  GPS L76K からのデータ受信とパース（100msタイムアウト）
     // - Loggerスレッド:  GPSデータのCSV記録（log_interval_ms 周期）
-    // - Displayスレッド: UI更新（1秒周期）
+    // - Displayスレッド: UI更新（更新通知駆動、max_fps で上限・idle_heartbeat_ms で下限）
+    // - Flushスレッド:   バックバッファのダーティ領域をLCDへ転送（Present() 駆動、TE 同期可）
     // - Touchスレッド:   タッチ入力監視（50msポーリング）
     // 
     std::cout << "All threads started. Press Ctrl+C to exit.\n";
@@ -0,0 +1,39 @@
+#include "display/baked_font.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace ui {
+
+namespace {
+
+#if defined(CYCOM_HAVE_BAKED_FONTS)
+// kBakedFonts / kBakedFontCount を定義する生成ファイル（cycom_font_bake の出力）
+#include "baked_font_data.inc"
+#else
+constexpr const BakedFont* kBakedFonts = nullptr;
+constexpr size_t kBakedFontCount = 0;
+#endif
+
+}  // namespace
+
+const BakedGlyph* BakedFont::Find(uint32_t cp) const {
+    const BakedGlyph* end = glyphs + count;
+    const BakedGlyph* it = std::lower_bound(
+        glyphs, end, cp, [](const BakedGlyph& g, uint32_t c) { return g.codepoint < c; });
+    return (it != end && it->codepoint == cp) ? it : nullptr;
+}
+
+const BakedFont* FindBakedFont(const char* family, const char* style, int size_px) {
+    if (!family || !style) return nullptr;
+    for (size_t i = 0; i < kBakedFontCount; ++i) {
+        const BakedFont& f = kBakedFonts[i];
+        if (f.size_px == size_px && std::strcmp(f.family, family) == 0 &&
+            std::strcmp(f.style, style) == 0) {
+            return &f;
+        }
+    }
+    return nullptr;
+}
+
+}  // namespace ui
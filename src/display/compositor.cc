@@ -0,0 +1,62 @@
+#include "display/compositor.h"
+
+#include <algorithm>
+
+#include "util/byte_swap.h"
+#include "util/image_loader.h"
+
+namespace display {
+
+Compositor::Compositor(Framebuffer& canvas)
+    : canvas_(canvas),
+      layer_(static_cast<size_t>(canvas.GetWidth()) * canvas.GetHeight(), 0xFFFF) {}
+
+bool Compositor::SetBackgroundImage(const std::string& path) {
+    std::vector<uint16_t> img;
+    if (!util::LoadImageRGB565(path, canvas_.GetWidth(), canvas_.GetHeight(), img)) {
+        return false;
+    }
+    layer_.swap(img);
+    version_ = ++last_version_;
+    return true;
+}
+
+void Compositor::SetBackgroundPanelPixels(const uint16_t* panel_px) {
+    util::SwapBytes16(panel_px, layer_.data(), layer_.size());
+    version_ = ++last_version_;
+}
+
+void Compositor::SetBackgroundPixels(const uint16_t* px, uint64_t version) {
+    std::copy(px, px + layer_.size(), layer_.begin());
+    version_ = version != 0 ? version : ++last_version_;
+}
+
+void Compositor::CaptureCanvas() {
+    const uint16_t* px = canvas_.Pixels();
+    std::copy(px, px + layer_.size(), layer_.begin());
+    version_ = ++last_version_;
+}
+
+void Compositor::SetBackgroundColor(uint16_t rgb565) {
+    std::fill(layer_.begin(), layer_.end(), rgb565);
+    version_ = ++last_version_;
+}
+
+void Compositor::Restore(const Rect& rect) {
+    const Rect r = Rect::Intersect(rect, canvas_.Bounds());
+    if (r.Empty()) return;
+    canvas_.DrawRGB565Rect(r.x, r.y, r.w, r.h,
+                           layer_.data() + static_cast<long>(r.y) * canvas_.GetWidth() + r.x,
+                           canvas_.GetWidth(), driver::PixelOrder::kHost);
+}
+
+void Compositor::RestoreAll() {
+    Restore(canvas_.Bounds());
+}
+
+SurfaceView Compositor::Layer() const {
+    const int w = canvas_.GetWidth();
+    return SurfaceView{layer_.data(), w, canvas_.GetHeight(), w, version_};
+}
+
+}  // namespace display
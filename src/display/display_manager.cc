@@ -1,12 +1,82 @@
 #include "display/display_manager.h"
 #include <chrono>
+#include <algorithm>
+#include <cmath>
 #include <cstdio>
+#include <cstring>
+#include <fstream>
 #include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <nlohmann/json.hpp>
+#include "display/widget/gauge.h"
+#include "display/widget/icon.h"
+#include "display/widget/label.h"
+#include "display/widget/numeric_field.h"
+#include "display/widget/scroll_chart.h"
 
 namespace display {
 
-DisplayManager::DisplayManager(driver::IDisplay& lcd, sensor::L76k& gps)
-    : lcd_(lcd), gps_(gps), tr_(lcd, "config/fonts/DejaVuSans.ttf") {
+namespace {
+
+/**
+ * @brief NMEA の緯度・経度（dddmm.mmmm）を度の10進表記にする
+ */
+std::string FormatCoordinate(double nmea, char dir) {
+    if (!std::isfinite(nmea) || dir == '\0') return "---";
+    const double deg = std::floor(nmea / 100.0) + std::fmod(nmea, 100.0) / 60.0;
+    char buf[24];
+    std::snprintf(buf, sizeof(buf), "%.5f %c", deg, dir);
+    return std::string(buf);
+}
+
+/**
+ * @brief GGA の測位品質の表示名
+ */
+std::string FixQualityName(uint8_t quality) {
+    switch (quality) {
+    case 0: return "NO FIX";
+    case 1: return "GPS";
+    case 2: return "DGPS";
+    case 4: return "RTK FIX";
+    case 5: return "RTK FLOAT";
+    case 6: return "DR";
+    default: return std::to_string(quality);
+    }
+}
+
+}  // namespace
+
+DisplayManager::DisplayManager(const std::string& config_path, driver::IDisplay& lcd,
+                               sensor::L76k& gps, util::UpdateNotifier& notifier)
+    : boot_start_(std::chrono::steady_clock::now()),
+      lcd_(lcd), gps_(gps), notifier_(notifier),
+      config_(LoadConfig(config_path)),
+      assets_(config_.asset_pack_path),
+      atlas_(config_.font_atlas_path),
+      flush_(lcd), compositor_(flush_.Canvas()),
+      page_cache_(flush_.Canvas().GetWidth(), flush_.Canvas().GetHeight(), config_.page_cache),
+      tr_(flush_.Canvas(), SelectFont(assets_)),
+      animator_(config_.animation_fps) {
+    min_frame_interval_ = std::chrono::milliseconds(1000 / config_.max_fps);
+    idle_heartbeat_ = std::chrono::milliseconds(config_.idle_heartbeat_ms);
+    tr_.SetGlyphCacheBudget(config_.glyph_cache_bytes, config_.rendered_glyph_cache_bytes);
+    tr_.SetGlyphMode(config_.glyph_mode);
+    tr_.SetLabelCacheBudget(config_.label_cache_bytes);
+    flush_.SetPixelFormat(config_.pixel_format);  // 最初のフレームの転送前に反映される
+    flush_.SetFramePacing(config_.frame_pacing);
+    if (atlas_.IsOpen()) {
+        tr_.SetGlyphAtlas(&atlas_);
+    } else {
+        std::cerr << "Glyph atlas not available, rasterising glyphs at runtime: "
+                  << config_.font_atlas_path << "\n";
+    }
+    if (!assets_.IsOpen()) {
+        std::cerr << "Asset pack not available, decoding assets at runtime: "
+                  << config_.asset_pack_path << "\n";
+    }
+
+    BuildPages();
     // 初期画面を表示
     ShowInitialScreens();
     // Touch / Logger / SensorManager と同様、コンストラクタで自動的にスレッドを起動
@@ -15,6 +85,28 @@ DisplayManager::DisplayManager(driver::IDisplay& lcd, sensor::L76k& gps)
 
 DisplayManager::~DisplayManager() {
     Stop();
+
+    const ui::GlyphCacheStats st = tr_.CacheStats();
+    std::cout << "Display: glyph cache alpha " << st.alpha.hits << " hit / " << st.alpha.misses
+              << " miss, " << st.alpha.bytes_used << " B; rendered " << st.rendered.hits
+              << " hit / " << st.rendered.misses << " miss, " << st.rendered.bytes_used
+              << " B; baked " << st.baked_hits << " hit; atlas " << st.atlas_hits << " hit; sdf "
+              << st.sdf.bytes_used << " B; labels " << st.labels.hits << " hit / "
+              << st.labels.misses << " miss, " << st.labels.bytes_used << " B\n";
+    const PageCache::Stats pc = page_cache_.GetStats();
+    std::cout << "Display: page cache " << pc.hits << " hit / " << pc.spill_hits << " spill hit / "
+              << pc.misses << " miss, " << pc.spills << " spilled, " << pc.evictions
+              << " evicted (" << pc.ram_pages << "/" << pc.ram_capacity << " in RAM, "
+              << pc.spill_pages << "/" << pc.spill_capacity << " in spill file)\n";
+    const FlushStats fs = flush_.GetStats();
+    const ui::AnimationScheduler::Stats& an = animator_.GetStats();
+    std::cout << "Display: flushed " << fs.frames << " frames, "
+              << (fs.frames ? fs.bytes / fs.frames : 0) << " B/frame avg, last "
+              << fs.last_frame_bytes << " B; transfer max " << fs.max_frame_time.count()
+              << " us; animation " << an.frames << " frames, "
+              << (an.frames ? an.total_frame_time.count() / static_cast<long long>(an.frames) : 0)
+              << " us avg / " << an.max_frame_time.count() << " us max, " << an.over_budget
+              << " over budget, " << an.dropped << " dropped\n";
 }
 
 void DisplayManager::Start() {
@@ -25,66 +117,424 @@ void DisplayManager::Start() {
 
 void DisplayManager::Stop() {
     bool was_running = running_.exchange(false, std::memory_order_acq_rel);
+    notifier_.Notify(util::kUpdateWakeup);  // 通知待ちのループを起こす
     if (was_running && th_.joinable()) {
         th_.join();
     }
 }
 
+DisplayManager::Config DisplayManager::LoadConfig(const std::string& config_path) {
+    std::ifstream ifs(config_path);
+    if (!ifs.is_open()) {
+        throw std::runtime_error("Failed to open config file");
+    }
+    nlohmann::json j;
+    ifs >> j;
+
+    Config c;
+    c.max_fps = std::max(1, j["display"]["max_fps"].get<int>());
+    c.idle_heartbeat_ms = std::max(1, j["display"]["idle_heartbeat_ms"].get<int>());
+    c.asset_pack_path = j["display"]["asset_pack"].get<std::string>();
+    c.font_atlas_path = j["display"]["font_atlas"].get<std::string>();
+    c.glyph_mode = j["display"]["glyph_mode"].get<std::string>() == "sdf" ? ui::GlyphMode::kSdf
+                                                                         : ui::GlyphMode::kBitmap;
+    c.glyph_cache_bytes = j["display"]["glyph_cache_kb"].get<size_t>() * 1024;
+    c.rendered_glyph_cache_bytes = j["display"]["rendered_glyph_cache_kb"].get<size_t>() * 1024;
+    c.label_cache_bytes = j["display"]["label_cache_kb"].get<size_t>() * 1024;
+    const std::string format = j["display"]["pixel_format"].get<std::string>();
+    if (format == "rgb444") {
+        c.pixel_format = driver::PixelFormat::kRGB444;
+    } else if (format == "rgb666") {
+        c.pixel_format = driver::PixelFormat::kRGB666;
+    } else if (format != "rgb565") {
+        std::cerr << "Unknown display.pixel_format \"" << format << "\", using rgb565\n";
+    }
+    const std::string pacing = j["display"]["frame_pacing"].get<std::string>();
+    if (pacing == "low_latency") {
+        c.frame_pacing = FramePacing::kLowLatency;
+    } else if (pacing != "tear_free") {
+        std::cerr << "Unknown display.frame_pacing \"" << pacing << "\", using tear_free\n";
+    }
+    c.page_cache.budget_bytes = j["display"]["page_cache_kb"].get<size_t>() * 1024;
+    const std::string policy = j["display"]["page_cache_policy"].get<std::string>();
+    if (policy == "fifo") {
+        c.page_cache.policy = PageEvictionPolicy::kFifo;
+    } else if (policy != "lru") {
+        std::cerr << "Unknown display.page_cache_policy \"" << policy << "\", using lru\n";
+    }
+    c.page_cache.spill_dir = j["display"]["page_spill_dir"].get<std::string>();
+    c.page_cache.spill_bytes = j["display"]["page_spill_kb"].get<size_t>() * 1024;
+    c.animation_fps = std::max(1, j["display"]["animation_fps"].get<int>());
+    c.tween = std::chrono::milliseconds(std::max(0, j["display"]["tween_ms"].get<int>()));
+    return c;
+}
+
+ui::FontSource DisplayManager::SelectFont(const util::AssetPack& assets) {
+    util::Asset font;
+    if (assets.Find("DejaVuSans.ttf", font) && font.type == util::AssetType::kFont) {
+        return ui::FontSource::Memory(font.data, font.size);
+    }
+    return ui::FontSource::File("config/fonts/DejaVuSans.ttf");
+}
+
+bool DisplayManager::ShowBackground(const std::string& name) {
+    Framebuffer& canvas = flush_.Canvas();
+
+    util::Asset img;
+    if (assets_.Find(name, img) && img.type == util::AssetType::kImageRGB565Panel &&
+        img.width == canvas.GetWidth() && img.height == canvas.GetHeight()) {
+        // パック済み画像はパネル形式のまま転送する（デコード・拡大縮小なし）
+        flush_.PresentFrame(reinterpret_cast<const uint16_t*>(img.data));
+        return true;
+    }
+
+    // パックにない場合は画像ファイルをデコードする
+    if (!canvas.DrawBackgroundImage("resource/background/" + name)) return false;
+    flush_.Present();
+    return true;
+}
+
+bool DisplayManager::LoadBackgroundLayer(const std::string& name) {
+    const Framebuffer& canvas = flush_.Canvas();
+
+    util::Asset img;
+    if (assets_.Find(name, img) && img.type == util::AssetType::kImageRGB565Panel &&
+        img.width == canvas.GetWidth() && img.height == canvas.GetHeight()) {
+        compositor_.SetBackgroundPanelPixels(reinterpret_cast<const uint16_t*>(img.data));
+        return true;
+    }
+    return compositor_.SetBackgroundImage("resource/background/" + name);
+}
+
 void DisplayManager::ShowInitialScreens() {
     // 起動画面を表示
-    if (!lcd_.DrawBackgroundImage("resource/background/start.jpg")) {
-        lcd_.Clear(0xFFFF);  // 失敗時は白でフォールバック
+    if (!ShowBackground("start.jpg")) {
+        flush_.Canvas().Clear(0xFFFF);  // 失敗時は白でフォールバック
+        flush_.Present();
     }
+    flush_.WaitIdle();
+    const auto boot_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - boot_start_);
+    std::cout << "Display: first frame shown " << boot_ms.count() << " ms after init ("
+              << (assets_.IsOpen() ? "asset pack" : "runtime decode") << ")\n";
     std::this_thread::sleep_for(std::chrono::seconds(5));
-    
-    // 計測画面を表示
-    if (!lcd_.DrawBackgroundImage("resource/background/measure.jpg")) {
-        lcd_.Clear(0xFFFF);  // 失敗時は白でフォールバック
+
+    // 最初のページを用意する（転送は DisplayLoop の最初のフレームで値と一緒に行う）
+    ShowPage(0);
+}
+
+void DisplayManager::ShowPage(size_t index) {
+    current_page_ = index;
+    Page& page = pages_[index];
+    const int id = static_cast<int>(index);
+
+    if (const uint16_t* cached = page_cache_.Find(id)) {
+        // 描画済みの静的部分をそのまま背景レイヤにする（デコード・テキスト描画なし）
+        // 保存時と同じ版に戻すため、このページのラベルはキャッシュから転送できる
+        compositor_.SetBackgroundPixels(cached, page.layer_version);
+        compositor_.RestoreAll();
+    } else {
+        // 背景の上に固定表示を描き、その結果を背景レイヤとしてキャッシュに保存する
+        if (!LoadBackgroundLayer(page.background)) {
+            compositor_.SetBackgroundColor(0xFFFF);  // 失敗時は白でフォールバック
+        }
+        compositor_.RestoreAll();
+        ui::RenderContext ctx{flush_.Canvas(), tr_, &compositor_, &flush_};
+        page.static_widgets.InvalidateAll();
+        page.static_widgets.Render(ctx);
+        compositor_.CaptureCanvas();
+        page.layer_version = compositor_.Layer().version;
+        if (uint16_t* surface = page_cache_.Insert(id)) {
+            std::memcpy(surface, compositor_.Layer().pixels, page_cache_.FrameBytes());
+        }
     }
+
+    // 前のページのハードウェアスクロールを戻す（チャートのあるページは描画時に設定し直す）
+    if (flush_.SupportsHardwareScroll()) {
+        const Framebuffer& canvas = flush_.Canvas();
+        const int lines = flush_.GetScrollAxis() == driver::ScrollAxis::kRows
+                              ? canvas.GetHeight()
+                              : canvas.GetWidth();
+        flush_.SetScroll(0, lines, 0);
+    }
+    page.widgets.InvalidateAll();
+}
+
+void DisplayManager::BuildPages() {
+    // 速度（時刻と速度の推移つき）
+    pages_.push_back(BuildValuePage("", [this]() { return gps_.GetGnvtgSpeed(); }, 1, "--.-",
+                                    "km/h", 60.0));
+
+    // 速度メーター
+    pages_.push_back(BuildGaugePage("SPEED", [this]() { return gps_.GetGnvtgSpeed(); }, 1, "--.-",
+                                    "km/h", 60.0));
+
+    // 高度（海抜）
+    pages_.push_back(BuildValuePage(
+        "ALT", [this]() { return gps_.Snapshot().gngga.altitude; }, 0, "----", "m", 2000.0));
+
+    // 位置と進行方向
+    ui::TextStyle value_style;
+    value_style.font_px = 36;
+    value_style.center = false;
+    value_style.tabular = true;
+    pages_.push_back(BuildTablePage(
+        "POSITION",
+        {{"LAT",
+          [this, value_style](const Rect& r) {
+              return std::make_unique<ui::Label>(
+                  r,
+                  [this]() {
+                      const sensor::GNRMC rmc = gps_.Snapshot().gnrmc;
+                      return FormatCoordinate(rmc.latitude, rmc.lat_dir);
+                  },
+                  value_style);
+          }},
+         {"LON",
+          [this, value_style](const Rect& r) {
+              return std::make_unique<ui::Label>(
+                  r,
+                  [this]() {
+                      const sensor::GNRMC rmc = gps_.Snapshot().gnrmc;
+                      return FormatCoordinate(rmc.longitude, rmc.lon_dir);
+                  },
+                  value_style);
+          }},
+         {"HDG",
+          [this, value_style](const Rect& r) {
+              return std::make_unique<ui::NumericField>(
+                  r, [this]() { return gps_.Snapshot().gnvtg.true_track_deg; }, 0,
+                  value_style, "---");
+          }}}));
+
+    // 測位状態
+    pages_.push_back(BuildTablePage(
+        "GNSS",
+        {{"FIX",
+          [this, value_style](const Rect& r) {
+              return std::make_unique<ui::Label>(
+                  r, [this]() { return FixQualityName(gps_.Snapshot().gngga.quality); },
+                  value_style);
+          }},
+         {"SAT",
+          [this, value_style](const Rect& r) {
+              return std::make_unique<ui::NumericField>(
+                  r,
+                  [this]() {
+                      return static_cast<double>(gps_.Snapshot().gngga.num_satellites);
+                  },
+                  0, value_style);
+          }},
+         {"HDOP",
+          [this, value_style](const Rect& r) {
+              return std::make_unique<ui::NumericField>(
+                  r, [this]() { return gps_.Snapshot().gngga.hdop; }, 1, value_style, "--.-");
+          }}}));
+}
+
+DisplayManager::Page DisplayManager::BuildValuePage(const std::string& title,
+                                                    const std::function<double()>& source,
+                                                    int decimals, const std::string& placeholder,
+                                                    const std::string& unit, double chart_max) {
+    Page page;
+    page.background = "measure.jpg";
+
+    const int W = flush_.Canvas().GetWidth();
+    const int H = flush_.Canvas().GetHeight();
+    const int MARGIN = 20;
+    // 横長の画面では右側を時系列チャートに充て、数値はその左に並べる
+    const bool landscape = W > H;
+    const int CONTENT_W = landscape ? W * 5 / 8 : W;
+
+    // 見出し（空なら時刻 UTC hh:mm）
+    ui::TextStyle title_style;
+    title_style.font_px = 28;
+    const display::Rect title_rect{MARGIN, MARGIN, CONTENT_W - 2 * MARGIN, 40};
+    if (!title.empty()) {
+        page.static_widgets.Add(std::make_unique<ui::Label>(title_rect, title, title_style));
+    } else {
+        page.widgets.Add(std::make_unique<ui::Label>(
+            title_rect,
+            [this]() -> std::string {
+                sensor::GnssSnapshot snap = gps_.Snapshot();
+                if (snap.gnrmc.hour > 23 || snap.gnrmc.minute > 59) return "--:--";
+                char buf[8];
+                std::snprintf(buf, sizeof(buf), "%02u:%02u",
+                              static_cast<unsigned>(snap.gnrmc.hour),
+                              static_cast<unsigned>(snap.gnrmc.minute));
+                return std::string(buf);
+            },
+            title_style));
+    }
+
+    // 値と単位
+    const int UNIT_W = CONTENT_W / 4;
+    const int VALUE_Y = H / 4;
+    const int VALUE_H = 100;
+
+    ui::TextStyle value_style;
+    value_style.font_px = 48;
+    value_style.center = false;
+    page.widgets.Add(std::make_unique<ui::NumericField>(
+        display::Rect{MARGIN, VALUE_Y, CONTENT_W - 2 * MARGIN - UNIT_W, VALUE_H}, source,
+        decimals, value_style, placeholder));
+
+    ui::TextStyle unit_style;
+    unit_style.font_px = 28;
+    page.static_widgets.Add(std::make_unique<ui::Label>(
+        display::Rect{CONTENT_W - MARGIN - UNIT_W, VALUE_Y, UNIT_W, VALUE_H}, unit, unit_style));
+
+    // 値の推移（スクロール方向に直交して画面の端から端までの帯にし、ハードウェアスクロールで
+    // 流す。1ライン = 1秒。横長なら右側の全高の帯を横に、縦長なら下部の全幅の帯を縦に流す）
+    const int CHART_Y = VALUE_Y + VALUE_H + MARGIN;
+    ui::ChartStyle chart_style;
+    chart_style.horizontal = landscape;
+    page.widgets.Add(std::make_unique<ui::ScrollChart>(
+        landscape ? display::Rect{CONTENT_W, 0, W - CONTENT_W, H}
+                  : display::Rect{0, CHART_Y, W, H - MARGIN - CHART_Y},
+        source, 0.0, chart_max, std::chrono::seconds(1), chart_style));
+    return page;
+}
+
+DisplayManager::Page DisplayManager::BuildGaugePage(const std::string& title,
+                                                    const std::function<double()>& source,
+                                                    int decimals, const std::string& placeholder,
+                                                    const std::string& unit, double gauge_max) {
+    Page page;
+    page.background = "measure.jpg";
+
+    const int W = flush_.Canvas().GetWidth();
+    const int H = flush_.Canvas().GetHeight();
+    const int MARGIN = 20;
+
+    ui::TextStyle title_style;
+    title_style.font_px = 28;
+    page.static_widgets.Add(std::make_unique<ui::Label>(
+        display::Rect{MARGIN, MARGIN, W - 2 * MARGIN, 40}, title, title_style));
+
+    // 横長ならメーターの右に、縦長なら下に数値と単位を並べる（メーターとは重ねない）
+    const int TOP = MARGIN + 40 + MARGIN / 2;
+    const int VALUE_H = 100;
+    const int UNIT_H = 40;
+    const bool landscape = W > H;
+    const int size = landscape ? std::min(H - TOP - MARGIN, W * 5 / 8 - MARGIN)
+                               : std::min(W - 2 * MARGIN, H - TOP - VALUE_H - MARGIN);
+    const display::Rect gauge_rect{landscape ? MARGIN : (W - size) / 2, TOP, size, size};
+    page.widgets.Add(std::make_unique<ui::Gauge>(gauge_rect, source, 0.0, gauge_max,
+                                                 config_.tween, ui::GaugeStyle{}));
+
+    ui::TextStyle value_style;
+    value_style.font_px = 48;
+    ui::TextStyle unit_style;
+    unit_style.font_px = 28;
+    if (landscape) {
+        const int x = gauge_rect.Right() + MARGIN;
+        const int y = TOP + (size - VALUE_H - UNIT_H) / 2;
+        page.widgets.Add(std::make_unique<ui::NumericField>(
+            display::Rect{x, y, W - x - MARGIN, VALUE_H}, source, decimals, value_style,
+            placeholder));
+        page.static_widgets.Add(std::make_unique<ui::Label>(
+            display::Rect{x, y + VALUE_H, W - x - MARGIN, UNIT_H}, unit, unit_style));
+    } else {
+        const int UNIT_W = W / 4;
+        const int y = gauge_rect.Bottom();
+        page.widgets.Add(std::make_unique<ui::NumericField>(
+            display::Rect{MARGIN, y, W - 2 * MARGIN - UNIT_W, VALUE_H}, source, decimals,
+            value_style, placeholder));
+        page.static_widgets.Add(std::make_unique<ui::Label>(
+            display::Rect{W - MARGIN - UNIT_W, y, UNIT_W, VALUE_H}, unit, unit_style));
+    }
+    AddStatusIcon(page);
+    return page;
+}
+
+void DisplayManager::AddStatusIcon(Page& page) {
+    const int W = flush_.Canvas().GetWidth();
+    const int MARGIN = 20;
+    const int SIZE = 40;  // 見出しの行の高さ
+    // 状態番号 0: 未測位、1: 測位中
+    page.widgets.Add(std::make_unique<ui::Icon>(
+        display::Rect{W - MARGIN - SIZE, MARGIN, SIZE, SIZE},
+        [this]() { return gps_.Snapshot().gngga.quality == 0 ? 0 : 1; },
+        std::vector<const ui::RleIcon*>{ui::FindRleIcon("gps_nofix"), ui::FindRleIcon("gps_fix")},
+        ui::Color565::White()));
+}
+
+DisplayManager::Page DisplayManager::BuildTablePage(
+    const std::string& title, const std::vector<std::pair<std::string, RowFactory>>& rows) {
+    Page page;
+    page.background = "measure.jpg";
+
+    const int W = flush_.Canvas().GetWidth();
+    const int H = flush_.Canvas().GetHeight();
+    const int MARGIN = 20;
+
+    ui::TextStyle title_style;
+    title_style.font_px = 28;
+    page.static_widgets.Add(std::make_unique<ui::Label>(
+        display::Rect{MARGIN, MARGIN, W - 2 * MARGIN, 40}, title, title_style));
+
+    // 項目名を左列、値を右列に並べる
+    const int TOP = MARGIN + 40 + MARGIN;
+    const int ROW_H = std::min(80, (H - TOP - MARGIN) / std::max<int>(1, rows.size()));
+    const int NAME_W = W / 3;
+    ui::TextStyle name_style;
+    name_style.font_px = 28;
+    name_style.center = false;
+    for (size_t i = 0; i < rows.size(); ++i) {
+        const int y = TOP + static_cast<int>(i) * ROW_H;
+        page.static_widgets.Add(std::make_unique<ui::Label>(
+            display::Rect{MARGIN, y, NAME_W - MARGIN, ROW_H}, rows[i].first, name_style));
+        page.widgets.Add(rows[i].second(display::Rect{NAME_W, y, W - NAME_W - MARGIN, ROW_H}));
+    }
+    AddStatusIcon(page);
+    return page;
 }
 
 void DisplayManager::DisplayLoop() {
     try {
-        // パネル定義
-        const int PANEL_X = 20;
-        const int PANEL_Y = 40;
-        const int PANEL_W = 440;
-        const int PANEL_H = 120;
-
-        // 単位エリア
-        tr_.SetFontSizePx(28);
-        tr_.SetColors(ui::Color565::Black(), ui::Color565::White());
-
-        const int UNIT_W = 120;
-        const int UNIT_X = PANEL_X + PANEL_W - UNIT_W;
-        const int UNIT_Y = PANEL_Y;
-        const int UNIT_H = PANEL_H;
-
-        // 数字エリア
-        const int NUM_X = PANEL_X + 40;
-        const int NUM_Y = PANEL_Y + 340;
-        const int NUM_W = (UNIT_X - 5) - NUM_X;
-        const int NUM_H = PANEL_H - 20;
-
-        tr_.SetFontSizePx(48);
-        tr_.SetColors(ui::Color565::Black(), ui::Color565::White());
-
-        const auto UPDATE_INTERVAL = std::chrono::milliseconds(1000);
-        std::string prev_text;
+        using Clock = util::UpdateNotifier::Clock;
+        ui::RenderContext ctx{flush_.Canvas(), tr_, &compositor_, &flush_};
+
+        Clock::time_point last_frame = Clock::now() - min_frame_interval_;
+        uint32_t events = 0;
+        bool page_changed = true;  // ShowInitialScreens() で用意したページをまだ送っていない
         
         while (running_.load(std::memory_order_acquire)) {
-            std::this_thread::sleep_for(UPDATE_INTERVAL);
+            // スワイプでページを切り替える（左で次、右で前のページ）
+            if (events & (util::kUpdateSwipeLeft | util::kUpdateSwipeRight)) {
+                const size_t n = pages_.size();
+                ShowPage((events & util::kUpdateSwipeLeft) ? (current_page_ + 1) % n
+                                                           : (current_page_ + n - 1) % n);
+                page_changed = true;
+            }
 
-            char buf[16];
-            double gnvtg_speed_kmh = gps_.GetGnvtgSpeed();
-            std::snprintf(buf, sizeof(buf), "%.1f", gnvtg_speed_kmh);
-            std::string cur_text(buf);
+            // 表示していないページも値を追う（チャートの履歴を途切れさせない）
+            const Clock::time_point frame_start = Clock::now();
+            for (Page& page : pages_) page.widgets.Update();
+            const bool animating = pages_[current_page_].widgets.Animate(frame_start);
+            if (pages_[current_page_].widgets.Render(ctx) > 0 || page_changed) {
+                flush_.Present();
+            }
+            page_changed = false;
+            last_frame = Clock::now();
 
-            if (cur_text != prev_text) {
-                tr_.SetWrapWidthPx(0);
-                tr_.DrawLabel(NUM_X, NUM_Y, NUM_W, NUM_H, cur_text, /*center=*/false);
-                prev_text = cur_text;
+            if (animating) {
+                // アニメーション中は通知を待たず、予算を超えたフレームは飛ばして次の周期で描く
+                animator_.FrameDone(frame_start, last_frame);
+                std::this_thread::sleep_until(animator_.NextFrame());
+                events = notifier_.Take();
+                continue;
             }
+            animator_.Idle();
+
+            // 更新通知かハートビート期限まで眠る
+            events = notifier_.WaitUntil(last_frame + idle_heartbeat_);
+            if (!running_.load(std::memory_order_acquire)) break;
+
+            // 最大フレームレートを超えないよう待つ（待機中の通知は次の Take でまとめて受け取る）
+            std::this_thread::sleep_until(last_frame + min_frame_interval_);
+            events |= notifier_.Take();
         }
     } catch (const std::exception& e) {
         std::cerr << "DisplayManager Fatal: " << e.what() << "\n";
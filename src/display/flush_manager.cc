@@ -0,0 +1,199 @@
+#include "display/flush_manager.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+
+#include "util/byte_swap.h"
+
+namespace display {
+
+namespace {
+// TE を待つ上限（60Hz 走査の約3周期）と、未接続とみなすまでの連続タイムアウト回数
+constexpr std::chrono::microseconds kVBlankTimeout{50000};
+constexpr int kMaxVBlankMisses = 3;
+}  // namespace
+
+FlushManager::FlushManager(driver::IDisplay& panel)
+    : panel_(panel),
+      canvas_(panel.GetWidth(), panel.GetHeight()),
+      front_(static_cast<size_t>(panel.GetWidth()) * panel.GetHeight(), 0x0000) {
+    // Touch / Logger / SensorManager と同様、コンストラクタで自動的にスレッドを起動
+    Start();
+}
+
+FlushManager::~FlushManager() {
+    Stop();
+}
+
+void FlushManager::Start() {
+    Stop(); // 既存スレッドが動いていれば停止
+    running_.store(true, std::memory_order_release);
+    th_ = std::thread([this]{ FlushLoop(); });
+}
+
+void FlushManager::Stop() {
+    {
+        std::lock_guard<std::mutex> lk(mtx_);
+        running_.store(false, std::memory_order_release);
+    }
+    cv_.notify_all();
+    // 転送スレッドが異常終了して running_ を下ろしている場合もあるため joinable で判定する
+    if (th_.joinable()) th_.join();
+}
+
+void FlushManager::Present() {
+    canvas_.TakeDirty(frame_dirty_);
+    if (frame_dirty_.empty() && !scroll_requested_.set && !format_requested_.set) return;
+
+    {
+        std::unique_lock<std::mutex> lk(mtx_);
+        cv_.wait(lk, [this]{ return !busy_ || !running_.load(std::memory_order_acquire); });
+        if (!running_.load(std::memory_order_acquire)) return;
+
+        // ポインタ交換のみ。以後 front_ がこのフレーム、canvas_ が前のフレームを持つ
+        canvas_.SwapPixels(front_);
+        pending_.swap(frame_dirty_);
+        scroll_pending_ = scroll_requested_;
+        scroll_requested_.set = false;
+        format_pending_ = format_requested_;
+        format_requested_.set = false;
+        busy_ = true;
+    }
+    cv_.notify_all();
+
+    // バックバッファを最新フレームに揃える。前フレームとの差分はこのフレームのダーティ領域だけなので、
+    // その部分だけをフロントから書き戻す（転送スレッドも front_ を読むだけなので並行して安全）
+    const int stride = canvas_.Stride();
+    uint16_t* back = canvas_.Pixels();
+    for (const Rect& r : pending_) {
+        for (int y = r.y; y < r.Bottom(); ++y) {
+            const size_t off = static_cast<size_t>(y) * stride + r.x;
+            std::memcpy(back + off, front_.data() + off, static_cast<size_t>(r.w) * 2);
+        }
+    }
+}
+
+void FlushManager::PresentFrame(const uint16_t* panel_px) {
+    std::unique_lock<std::mutex> lk(mtx_);
+    cv_.wait(lk, [this]{ return !busy_ || !running_.load(std::memory_order_acquire); });
+    if (!running_.load(std::memory_order_acquire)) return;
+
+    // 両バッファを同じ内容にしておく（転送スレッドは停止中なので front_ に書いてよい）
+    util::SwapBytes16(panel_px, front_.data(), front_.size());
+    std::memcpy(canvas_.Pixels(), front_.data(), front_.size() * 2);
+    canvas_.TakeDirty(frame_dirty_);
+    pending_.clear();
+    format_pending_ = format_requested_;
+    format_requested_.set = false;
+    direct_frame_ = panel_px;
+    busy_ = true;
+    lk.unlock();
+    cv_.notify_all();
+}
+
+void FlushManager::SetPixelFormat(driver::PixelFormat format) {
+    format_requested_ = FormatChange{format, true};
+}
+
+void FlushManager::SetScroll(int top, int height, int start) {
+    scroll_requested_ = Scroll{top, height, start, true};
+}
+
+FlushStats FlushManager::GetStats() const {
+    std::lock_guard<std::mutex> lk(mtx_);
+    return stats_;
+}
+
+void FlushManager::WaitIdle() {
+    std::unique_lock<std::mutex> lk(mtx_);
+    cv_.wait(lk, [this]{ return !busy_ || !running_.load(std::memory_order_acquire); });
+}
+
+void FlushManager::WaitForVBlank() {
+    if (vblank_lost_ || !panel_.SupportsVBlankSync()) return;
+    if (panel_.WaitForVBlank(kVBlankTimeout)) {
+        vblank_misses_ = 0;
+        return;
+    }
+    if (++vblank_misses_ >= kMaxVBlankMisses) {
+        std::cerr << "FlushManager: no TE signal from panel, sending frames without vblank sync\n";
+        vblank_lost_ = true;
+    }
+}
+
+void FlushManager::FlushLoop() {
+    try {
+        const int stride = canvas_.Stride();
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lk(mtx_);
+                cv_.wait(lk, [this]{ return busy_ || !running_.load(std::memory_order_acquire); });
+                if (!busy_) break;  // 停止要求かつ転送待ちなし
+            }
+
+            // busy_ の間は描画側が front_ / pending_ に触れないのでロック不要
+
+            // 走査がパネルの先頭へ戻った直後から送り始める
+            if (pacing_.load(std::memory_order_relaxed) == FramePacing::kTearFree) {
+                WaitForVBlank();
+            }
+
+            // 転送形式はこのフレームを送る前に切り替える
+            if (format_pending_.set) {
+                if (panel_.SetPixelFormat(format_pending_.format)) {
+                    format_ = format_pending_.format;
+                } else {
+                    std::cerr << "FlushManager: pixel format not supported by panel\n";
+                }
+                format_pending_.set = false;
+            }
+            const auto start = std::chrono::steady_clock::now();
+            size_t bytes = 0;
+            if (direct_frame_) {
+                panel_.DrawRGB565Rect(0, 0, canvas_.GetWidth(), canvas_.GetHeight(), direct_frame_,
+                                      stride, driver::PixelOrder::kPanel);
+                bytes += driver::TransferBytes(format_, front_.size());
+                direct_frame_ = nullptr;
+            }
+            for (const Rect& r : pending_) {
+                const uint16_t* src = front_.data() + static_cast<size_t>(r.y) * stride + r.x;
+                panel_.DrawRGB565Rect(r.x, r.y, r.w, r.h, src, stride, driver::PixelOrder::kHost);
+                bytes += driver::TransferBytes(format_, static_cast<size_t>(r.w) * r.h);
+            }
+            const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - start);
+            // スクロールは描いた行を送り終えてから切り替える
+            if (scroll_pending_.set) {
+                panel_.SetScrollArea(scroll_pending_.top, scroll_pending_.height);
+                panel_.SetScrollStart(scroll_pending_.start);
+                scroll_pending_.set = false;
+            }
+
+            {
+                std::lock_guard<std::mutex> lk(mtx_);
+                busy_ = false;
+                ++stats_.frames;
+                stats_.bytes += bytes;
+                stats_.last_frame_bytes = bytes;
+                stats_.last_frame_time = elapsed;
+                stats_.max_frame_time = std::max(stats_.max_frame_time, elapsed);
+            }
+            cv_.notify_all();
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "FlushManager Fatal: " << e.what() << "\n";
+        {
+            std::lock_guard<std::mutex> lk(mtx_);
+            busy_ = false;
+            direct_frame_ = nullptr;
+            scroll_pending_.set = false;
+            format_pending_.set = false;
+            running_.store(false, std::memory_order_release);
+        }
+        cv_.notify_all();
+    }
+}
+
+}  // namespace display
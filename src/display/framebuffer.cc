@@ -0,0 +1,107 @@
+#include "display/framebuffer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#include "util/byte_swap.h"
+#include "util/image_loader.h"
+
+namespace display {
+
+Framebuffer::Framebuffer(int width, int height)
+    : width_(width), height_(height), pixels_(static_cast<size_t>(width) * height, 0x0000) {
+    if (width <= 0 || height <= 0) {
+        throw std::invalid_argument("Framebuffer: invalid size");
+    }
+    dirty_.reserve(kMaxDirtyRects + 1);
+}
+
+void Framebuffer::Clear(uint16_t rgb565) {
+    std::fill(pixels_.begin(), pixels_.end(), rgb565);
+    MarkDirty(Bounds());
+}
+
+void Framebuffer::DrawRGB565Line(int x, int y, const uint16_t* rgb565, int len) {
+    DrawRGB565Rect(x, y, len, 1, rgb565, len, driver::PixelOrder::kHost);
+}
+
+void Framebuffer::DrawRGB565Rect(int x, int y, int w, int h, const uint16_t* px, int stride_px,
+                                 driver::PixelOrder order) {
+    const Rect r = Rect::Intersect(Rect{x, y, w, h}, Bounds());
+    if (r.Empty()) return;
+
+    for (int row = 0; row < r.h; ++row) {
+        const uint16_t* src =
+            px + static_cast<size_t>(r.y - y + row) * stride_px + (r.x - x);
+        uint16_t* dst = pixels_.data() + static_cast<size_t>(r.y + row) * width_ + r.x;
+        if (order == driver::PixelOrder::kPanel) {
+            util::SwapBytes16(src, dst, r.w);
+        } else {
+            std::memcpy(dst, src, static_cast<size_t>(r.w) * 2);
+        }
+    }
+    MarkDirty(r);
+}
+
+bool Framebuffer::DrawBackgroundImage(const std::string& path) {
+    std::vector<uint16_t> img;
+    if (!util::LoadImageRGB565(path, width_, height_, img)) {
+        return false;
+    }
+    DrawRGB565Rect(0, 0, width_, height_, img.data(), width_, driver::PixelOrder::kHost);
+    return true;
+}
+
+void Framebuffer::FillRect(const Rect& rect, uint16_t rgb565) {
+    const Rect r = Rect::Intersect(rect, Bounds());
+    if (r.Empty()) return;
+    for (int y = r.y; y < r.Bottom(); ++y) {
+        uint16_t* dst = pixels_.data() + static_cast<size_t>(y) * width_ + r.x;
+        std::fill(dst, dst + r.w, rgb565);
+    }
+    MarkDirty(r);
+}
+
+void Framebuffer::MarkDirty(const Rect& rect) {
+    Rect r = Rect::Intersect(rect, Bounds());
+    if (r.Empty()) return;
+
+    // 重なる・接する矩形を吸収しながら統合する
+    bool merged = true;
+    while (merged) {
+        merged = false;
+        for (size_t i = 0; i < dirty_.size(); ++i) {
+            if (dirty_[i].Touches(r)) {
+                r = Rect::Union(r, dirty_[i]);
+                dirty_[i] = dirty_.back();
+                dirty_.pop_back();
+                merged = true;
+                break;
+            }
+        }
+    }
+    dirty_.push_back(r);
+
+    if (dirty_.size() > kMaxDirtyRects) {
+        Rect all;
+        for (const Rect& d : dirty_) all = Rect::Union(all, d);
+        dirty_.clear();
+        dirty_.push_back(all);
+    }
+}
+
+void Framebuffer::TakeDirty(std::vector<Rect>& out) {
+    out.clear();
+    out.swap(dirty_);
+    dirty_.reserve(kMaxDirtyRects + 1);
+}
+
+void Framebuffer::SwapPixels(std::vector<uint16_t>& other) {
+    if (other.size() != pixels_.size()) {
+        throw std::invalid_argument("Framebuffer::SwapPixels: size mismatch");
+    }
+    pixels_.swap(other);
+}
+
+}  // namespace display
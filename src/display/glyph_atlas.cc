@@ -0,0 +1,76 @@
+#include "display/glyph_atlas.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+namespace ui {
+
+const GlyphAtlasGlyph* GlyphAtlasView::Find(uint32_t cp) const {
+    const GlyphAtlasGlyph* end = glyphs + count;
+    const GlyphAtlasGlyph* it = std::lower_bound(
+        glyphs, end, cp, [](const GlyphAtlasGlyph& g, uint32_t c) { return g.codepoint < c; });
+    return (it != end && it->codepoint == cp) ? it : nullptr;
+}
+
+GlyphAtlas::GlyphAtlas(const std::string& path) : file_(path) {
+    if (!file_.IsOpen()) return;
+    if (file_.Size() < sizeof(GlyphAtlasHeader)) return;
+
+    GlyphAtlasHeader header;
+    std::memcpy(&header, file_.Data(), sizeof(header));
+    if (std::memcmp(header.magic, kGlyphAtlasMagic, sizeof(header.magic)) != 0 ||
+        header.version != kGlyphAtlasVersion) {
+        std::fprintf(stderr, "Invalid glyph atlas: %s\n", path.c_str());
+        return;
+    }
+    const size_t table_end = sizeof(GlyphAtlasHeader) + sizeof(GlyphAtlasFace) * header.face_count;
+    if (table_end > file_.Size()) return;
+
+    const GlyphAtlasFace* faces =
+        reinterpret_cast<const GlyphAtlasFace*>(file_.Data() + sizeof(GlyphAtlasHeader));
+    for (uint32_t i = 0; i < header.face_count; ++i) {
+        const GlyphAtlasFace& f = faces[i];
+        const uint64_t glyph_end = f.glyph_offset + sizeof(GlyphAtlasGlyph) * f.glyph_count;
+        const uint64_t atlas_end = f.atlas_offset + uint64_t{f.atlas_width} * f.atlas_height;
+        if (glyph_end > file_.Size() || atlas_end > file_.Size()) {
+            std::fprintf(stderr, "Truncated glyph atlas: %s\n", path.c_str());
+            return;
+        }
+        // 描画時は境界を確かめずにアトラス画像を読むため、各グリフの矩形をここで検査する
+        const GlyphAtlasGlyph* glyphs =
+            reinterpret_cast<const GlyphAtlasGlyph*>(file_.Data() + f.glyph_offset);
+        for (uint32_t j = 0; j < f.glyph_count; ++j) {
+            const GlyphAtlasGlyph& g = glyphs[j];
+            if (g.width < 0 || g.height < 0 ||
+                uint64_t{g.x} + static_cast<uint64_t>(g.width) > f.atlas_width ||
+                uint64_t{g.y} + static_cast<uint64_t>(g.height) > f.atlas_height) {
+                std::fprintf(stderr, "Invalid glyph atlas: %s\n", path.c_str());
+                return;
+            }
+        }
+    }
+    faces_ = faces;
+    count_ = header.face_count;
+}
+
+bool GlyphAtlas::FindFace(const char* family, const char* style, int size_px,
+                          GlyphAtlasView& out) const {
+    if (!family || !style) return false;
+    for (uint32_t i = 0; i < count_; ++i) {
+        const GlyphAtlasFace& f = faces_[i];
+        if (static_cast<int>(f.size_px) != size_px ||
+            std::strncmp(f.family, family, kGlyphAtlasNameLen) != 0 ||
+            std::strncmp(f.style, style, kGlyphAtlasNameLen) != 0) {
+            continue;
+        }
+        out.glyphs = reinterpret_cast<const GlyphAtlasGlyph*>(file_.Data() + f.glyph_offset);
+        out.count = f.glyph_count;
+        out.atlas = file_.Data() + f.atlas_offset;
+        out.pitch = static_cast<int>(f.atlas_width);
+        return true;
+    }
+    return false;
+}
+
+}  // namespace ui
@@ -0,0 +1,204 @@
+#include "display/page_cache.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+namespace display {
+
+PageCache::PageCache(int width, int height, const Config& config)
+    : frame_px_(static_cast<size_t>(std::max(0, width)) * std::max(0, height)),
+      policy_(config.policy),
+      ram_slots_(frame_px_ == 0 ? 0 : config.budget_bytes / FrameBytes()) {
+    if (ram_slots_ > 0) ram_.reset(new uint16_t[ram_slots_ * frame_px_]);
+    if (frame_px_ > 0 && !config.spill_dir.empty()) {
+        const size_t slots = config.spill_bytes / FrameBytes();
+        if (slots > 0) OpenSpill(config.spill_dir, slots);
+    }
+}
+
+PageCache::~PageCache() {
+    if (spill_) ::munmap(spill_, spill_map_bytes_);
+}
+
+int PageCache::CreateSpillFile(const std::string& dir) {
+    // 自身だけが書き込めるディレクトリでなければ使わない（他のユーザーに中身を差し替えられない）
+    if (::mkdir(dir.c_str(), 0700) != 0 && errno != EEXIST) return -1;
+    struct stat st;
+    if (::lstat(dir.c_str(), &st) != 0 || !S_ISDIR(st.st_mode) || st.st_uid != ::geteuid() ||
+        (st.st_mode & (S_IWGRP | S_IWOTH)) != 0) {
+        return -1;
+    }
+
+    int fd = -1;
+#if defined(O_TMPFILE)
+    // 名前のないファイル（既存のファイルやリンクを開くことがなく、終了時に自動で消える）
+    fd = ::open(dir.c_str(), O_TMPFILE | O_RDWR | O_EXCL | O_CLOEXEC, 0600);
+    if (fd >= 0) return fd;
+    // O_TMPFILE に対応しないファイルシステムでは mkstemp を使う
+#endif
+    std::string tmpl = dir + "/cycom_pages.XXXXXX";
+    std::vector<char> path(tmpl.begin(), tmpl.end());
+    path.push_back('\0');
+    // mkostemp は O_CREAT | O_EXCL で新しいファイルだけを作る
+    fd = ::mkostemp(path.data(), O_CLOEXEC);
+    if (fd < 0) return -1;
+    ::unlink(path.data());
+    return fd;
+}
+
+void PageCache::OpenSpill(const std::string& dir, size_t slots) {
+    const size_t bytes = slots * FrameBytes();
+    const int fd = CreateSpillFile(dir);
+    if (fd < 0) {
+        std::cerr << "PageCache: cannot create spill file in " << dir
+                  << " (must be a directory writable only by this user), spilling disabled\n";
+        return;
+    }
+    // 領域を先に確保しておく（疎なファイルだと書き込み時に容量不足で SIGBUS になる）
+    void* p = MAP_FAILED;
+    if (::posix_fallocate(fd, 0, static_cast<off_t>(bytes)) == 0) {
+        p = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    // ファイルに名前はないため、閉じればマッピングの解除とともに消える
+    ::close(fd);
+    if (p == MAP_FAILED) {
+        std::cerr << "PageCache: cannot map spill file in " << dir << ", spilling disabled\n";
+        return;
+    }
+    spill_ = static_cast<uint16_t*>(p);
+    spill_map_bytes_ = bytes;
+    spill_slots_ = slots;
+}
+
+const uint16_t* PageCache::Find(int page) {
+    auto it = FindEntry(page);
+    if (it == entries_.end()) {
+        ++misses_;
+        return nullptr;
+    }
+    it->used = ++clock_;
+    if (it->in_ram) {
+        ++hits_;
+        return SlotPixels(true, it->slot);
+    }
+    ++spill_hits_;
+    if (ram_slots_ == 0) return SlotPixels(false, it->slot);
+
+    // RAM 側へ移す。空きがなければ RAM 側の1枚とサーフェスを入れ替える
+    for (size_t s = 0; s < ram_slots_; ++s) {
+        if (SlotUsed(true, s)) continue;
+        std::memcpy(SlotPixels(true, s), SlotPixels(false, it->slot), FrameBytes());
+        it->in_ram = true;
+        it->slot = s;
+        return SlotPixels(true, s);
+    }
+    auto victim = Victim(true);
+    uint16_t* ram = SlotPixels(true, victim->slot);
+    std::swap_ranges(ram, ram + frame_px_, SlotPixels(false, it->slot));
+    std::swap(victim->slot, it->slot);
+    victim->in_ram = false;
+    it->in_ram = true;
+    ++spills_;
+    return ram;
+}
+
+uint16_t* PageCache::Insert(int page) {
+    Erase(page);
+    const bool in_ram = ram_slots_ > 0;
+    if (!in_ram && spill_slots_ == 0) return nullptr;
+
+    const size_t slot = TakeSlot(in_ram);
+    ++clock_;
+    entries_.push_back(Entry{page, in_ram, slot, clock_, clock_});
+    return SlotPixels(in_ram, slot);
+}
+
+void PageCache::Erase(int page) {
+    auto it = FindEntry(page);
+    if (it != entries_.end()) entries_.erase(it);
+}
+
+void PageCache::Clear() {
+    entries_.clear();
+}
+
+PageCache::Stats PageCache::GetStats() const {
+    Stats s;
+    s.hits = hits_;
+    s.spill_hits = spill_hits_;
+    s.misses = misses_;
+    s.spills = spills_;
+    s.evictions = evictions_;
+    for (const Entry& e : entries_) {
+        if (e.in_ram) {
+            ++s.ram_pages;
+        } else {
+            ++s.spill_pages;
+        }
+    }
+    s.ram_capacity = ram_slots_;
+    s.spill_capacity = spill_slots_;
+    return s;
+}
+
+uint16_t* PageCache::SlotPixels(bool in_ram, size_t slot) {
+    return (in_ram ? ram_.get() : spill_) + slot * frame_px_;
+}
+
+std::vector<PageCache::Entry>::iterator PageCache::FindEntry(int page) {
+    return std::find_if(entries_.begin(), entries_.end(),
+                        [page](const Entry& e) { return e.page == page; });
+}
+
+std::vector<PageCache::Entry>::iterator PageCache::Victim(bool in_ram) {
+    auto age = [this](const Entry& e) {
+        return policy_ == PageEvictionPolicy::kLru ? e.used : e.inserted;
+    };
+    auto victim = entries_.end();
+    for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+        if (it->in_ram != in_ram) continue;
+        if (victim == entries_.end() || age(*it) < age(*victim)) victim = it;
+    }
+    return victim;
+}
+
+size_t PageCache::TakeSlot(bool in_ram) {
+    const size_t slots = in_ram ? ram_slots_ : spill_slots_;
+    for (size_t s = 0; s < slots; ++s) {
+        if (!SlotUsed(in_ram, s)) return s;
+    }
+
+    auto victim = Victim(in_ram);
+    const size_t slot = victim->slot;
+    if (in_ram && spill_slots_ > 0) {
+        // RAM から溢れたページはスピルファイルへ移す（スピル側が満杯ならそちらで1枚破棄される）
+        const int page = victim->page;
+        const size_t to = TakeSlot(false);
+        victim = FindEntry(page);
+        std::memcpy(SlotPixels(false, to), SlotPixels(true, slot), FrameBytes());
+        victim->in_ram = false;
+        victim->slot = to;
+        ++spills_;
+    } else {
+        entries_.erase(victim);
+        ++evictions_;
+    }
+    return slot;
+}
+
+bool PageCache::SlotUsed(bool in_ram, size_t slot) const {
+    return std::any_of(entries_.begin(), entries_.end(), [in_ram, slot](const Entry& e) {
+        return e.in_ram == in_ram && e.slot == slot;
+    });
+}
+
+}  // namespace display
@@ -0,0 +1,412 @@
+#include "display/rasterizer.h"
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+
+#include "util/blend565.h"
+
+namespace display {
+
+namespace {
+constexpr float kPi = 3.14159265358979f;
+constexpr float kArcTolerancePx = 1.0f / 32;  // 円弧を折れ線で近似するときの最大誤差
+constexpr int kXFracBits = 16;                  // 辺の x を行ごとに進めるときの小数部
+constexpr int64_t kXOne = int64_t{1} << kXFracBits;
+}  // namespace
+
+void Rasterizer::SetClip(const Rect& clip) {
+    clip_ = clip;
+    has_clip_ = true;
+}
+
+void Rasterizer::ResetClip() {
+    has_clip_ = false;
+}
+
+int32_t Rasterizer::ToFixed(float v) {
+    // 24.8 で表せる範囲に収める（画面外の座標は描画範囲で切るので値を潰してよい）
+    const float limit = static_cast<float>(1 << (30 - kSubpixelBits));
+    return static_cast<int32_t>(std::lround(std::clamp(v, -limit, limit) * kOne));
+}
+
+void Rasterizer::MoveTo(float x, float y) {
+    Close();
+    start_x_ = cur_x_ = ToFixed(x);
+    start_y_ = cur_y_ = ToFixed(y);
+    if (!has_points_) {
+        min_x_ = max_x_ = cur_x_;
+        min_y_ = max_y_ = cur_y_;
+        has_points_ = true;
+    }
+    min_x_ = std::min(min_x_, cur_x_);
+    max_x_ = std::max(max_x_, cur_x_);
+    min_y_ = std::min(min_y_, cur_y_);
+    max_y_ = std::max(max_y_, cur_y_);
+    open_ = true;
+}
+
+void Rasterizer::LineTo(float x, float y) {
+    if (!open_) {
+        MoveTo(x, y);
+        return;
+    }
+    const int32_t fx = ToFixed(x), fy = ToFixed(y);
+    AddEdge(cur_x_, cur_y_, fx, fy);
+    cur_x_ = fx;
+    cur_y_ = fy;
+    min_x_ = std::min(min_x_, fx);
+    max_x_ = std::max(max_x_, fx);
+    min_y_ = std::min(min_y_, fy);
+    max_y_ = std::max(max_y_, fy);
+}
+
+void Rasterizer::Close() {
+    if (!open_) return;
+    AddEdge(cur_x_, cur_y_, start_x_, start_y_);
+    cur_x_ = start_x_;
+    cur_y_ = start_y_;
+    open_ = false;
+}
+
+void Rasterizer::AddPolygon(const PointF* pts, size_t n) {
+    if (n < 3) return;
+    MoveTo(pts[0].x, pts[0].y);
+    for (size_t i = 1; i < n; ++i) LineTo(pts[i].x, pts[i].y);
+    Close();
+}
+
+void Rasterizer::AddLine(float x0, float y0, float x1, float y1, float width) {
+    const float dx = x1 - x0, dy = y1 - y0;
+    const float len = std::hypot(dx, dy);
+    if (len <= 0.0f || width <= 0.0f) return;
+    // 線分の法線方向に太さの半分ずつ広げた四角形
+    const float nx = -dy / len * width * 0.5f;
+    const float ny = dx / len * width * 0.5f;
+    const PointF quad[4] = {
+        {x0 + nx, y0 + ny}, {x1 + nx, y1 + ny}, {x1 - nx, y1 - ny}, {x0 - nx, y0 - ny}};
+    AddPolygon(quad, 4);
+}
+
+void Rasterizer::AddCircle(float cx, float cy, float r) {
+    if (r <= 0.0f) return;
+    AppendArc(cx, cy, r, 0.0f, 2.0f * kPi, /*move=*/true);
+    Close();
+}
+
+void Rasterizer::AddArc(float cx, float cy, float r, float start_deg, float sweep_deg,
+                        float width) {
+    if (width <= 0.0f || sweep_deg == 0.0f) return;
+    const float outer = r + width * 0.5f;
+    const float inner = std::max(0.0f, r - width * 0.5f);
+    if (outer <= 0.0f) return;
+
+    if (std::fabs(sweep_deg) >= 360.0f) {
+        // リング: 外周と逆向きの内周（非ゼロ規則でも内周が穴になる）
+        AppendArc(cx, cy, outer, 0.0f, 2.0f * kPi, /*move=*/true);
+        Close();
+        if (inner > 0.0f) {
+            AppendArc(cx, cy, inner, 0.0f, -2.0f * kPi, /*move=*/true);
+            Close();
+        }
+        return;
+    }
+    // 外周を開始角から進み、内周を逆にたどって戻る
+    const float start = start_deg * kPi / 180.0f;
+    const float sweep = sweep_deg * kPi / 180.0f;
+    AppendArc(cx, cy, outer, start, sweep, /*move=*/true);
+    AppendArc(cx, cy, inner, start + sweep, -sweep, /*move=*/false);
+    Close();
+}
+
+void Rasterizer::AppendArc(float cx, float cy, float r, float start_rad, float sweep_rad,
+                           bool move) {
+    if (r <= 0.0f) {
+        if (move) {
+            MoveTo(cx, cy);
+        } else {
+            LineTo(cx, cy);
+        }
+        return;
+    }
+    // 弦と円弧の距離が許容誤差に収まる角度刻み
+    const float max_step = r > kArcTolerancePx ? 2.0f * std::acos(1.0f - kArcTolerancePx / r)
+                                               : kPi / 2.0f;
+    const int n = std::max(1, static_cast<int>(std::ceil(std::fabs(sweep_rad) / max_step)));
+    const float step = sweep_rad / n;
+
+    // 頂点ごとの三角関数を避け、中心からのベクトルを一定角ずつ回転させる
+    const float c = std::cos(step), s = std::sin(step);
+    float vx = r * std::cos(start_rad), vy = r * std::sin(start_rad);
+    for (int i = 0; i <= n; ++i) {
+        if (i == 0 && move) {
+            MoveTo(cx + vx, cy + vy);
+        } else {
+            LineTo(cx + vx, cy + vy);
+        }
+        const float nx = vx * c - vy * s;
+        vy = vx * s + vy * c;
+        vx = nx;
+    }
+}
+
+void Rasterizer::AddEdge(int32_t x0, int32_t y0, int32_t x1, int32_t y1) {
+    if (y0 == y1) return;  // 水平な辺は被覆に寄与しない
+    int dir = 1;
+    if (y0 > y1) {
+        std::swap(x0, x1);
+        std::swap(y0, y1);
+        dir = -1;
+    }
+    const int64_t slope = static_cast<int64_t>(x1 - x0) * kXOne / (y1 - y0);
+    edges_.push_back(Edge{x0, y0, x1, y1, dir, slope, 0});
+}
+
+void Rasterizer::Reset() {
+    edges_.clear();
+    open_ = false;
+    has_points_ = false;
+}
+
+Rect Rasterizer::Fill(Framebuffer& canvas, uint16_t rgb565, FillRule rule, uint8_t opacity) {
+    Close();
+    Rect area = canvas.Bounds();
+    if (has_clip_) area = Rect::Intersect(area, clip_);
+    if (edges_.empty() || opacity == 0) {
+        Reset();
+        return Rect{};
+    }
+
+    // 輪郭の外接矩形（ピクセル単位）と描画範囲の共通部分だけを走査する
+    const int bx0 = min_x_ >> kSubpixelBits;
+    const int by0 = min_y_ >> kSubpixelBits;
+    const int bx1 = (max_x_ + kOne - 1) >> kSubpixelBits;
+    const int by1 = (max_y_ + kOne - 1) >> kSubpixelBits;
+    const Rect r = Rect::Intersect(area, Rect{bx0, by0, bx1 - bx0, by1 - by0});
+    if (r.Empty()) {
+        Reset();
+        return Rect{};
+    }
+
+    row_width_ = r.w;
+    cells_.assign(static_cast<size_t>(r.w) + 1, Cell{0, 0});
+    alpha_.resize(static_cast<size_t>(r.w));
+    std::sort(edges_.begin(), edges_.end(),
+              [](const Edge& a, const Edge& b) { return a.y0 < b.y0; });
+
+    const int64_t ox = static_cast<int64_t>(r.x) << kSubpixelBits;
+    active_.clear();
+    size_t next = 0;
+    int dx0 = INT_MAX, dx1 = -1, dy0 = -1, dy1 = -1;
+
+    for (int y = r.y; y < r.Bottom(); ++y) {
+        const int32_t top = y << kSubpixelBits;
+        const int32_t bottom = top + kOne;
+
+        // この行にかかり始めた辺を加える（描画範囲より上から来る辺は行の上端の x から始める）
+        while (next < edges_.size() && edges_[next].y0 < bottom) {
+            Edge& e = edges_[next];
+            if (e.y1 > top) {
+                e.xf = static_cast<int64_t>(e.x0) * kXOne + e.slope * (std::max(top, e.y0) - e.y0);
+                active_.push_back(next);
+            }
+            ++next;
+        }
+
+        cell_min_ = INT_MAX;
+        cell_max_ = -1;
+        for (size_t i = 0; i < active_.size();) {
+            Edge& e = edges_[active_[i]];
+            const int32_t ya = std::max(top, e.y0);
+            const int32_t yb = std::min(bottom, e.y1);
+            // 辺の終点を含む行では誤差を残さないよう終点の座標をそのまま使う
+            const int64_t xbf = yb == e.y1 ? static_cast<int64_t>(e.x1) * kXOne
+                                           : e.xf + e.slope * (yb - ya);
+            const int64_t xa = (e.xf >> kXFracBits) - ox;
+            const int64_t xb = (xbf >> kXFracBits) - ox;
+            e.xf = xbf;
+            if (e.dir > 0) {
+                RenderClipped(xa, ya - top, xb, yb - top);
+            } else {
+                RenderClipped(xb, yb - top, xa, ya - top);
+            }
+
+            if (e.y1 <= bottom) {
+                active_[i] = active_.back();
+                active_.pop_back();
+            } else {
+                ++i;
+            }
+        }
+
+        int x_min = 0, x_max = 0;
+        uint16_t* row = canvas.Pixels() + static_cast<size_t>(y) * canvas.Stride() + r.x;
+        if (SweepRow(row, rgb565, rule, opacity, &x_min, &x_max)) {
+            dx0 = std::min(dx0, x_min);
+            dx1 = std::max(dx1, x_max);
+            if (dy0 < 0) dy0 = y;
+            dy1 = y;
+        }
+        if (next >= edges_.size() && active_.empty()) break;
+    }
+    Reset();
+
+    if (dy0 < 0) return Rect{};
+    const Rect dirty{r.x + dx0, dy0, dx1 - dx0 + 1, dy1 - dy0 + 1};
+    canvas.MarkDirty(dirty);
+    return dirty;
+}
+
+void Rasterizer::RenderClipped(int64_t x1, int32_t y1, int64_t x2, int32_t y2) {
+    if (y1 == y2) return;
+    const int64_t right = static_cast<int64_t>(row_width_) << kSubpixelBits;
+    auto y_at = [&](int64_t x) {
+        return static_cast<int32_t>(y1 + (y2 - y1) * (x - x1) / (x2 - x1));
+    };
+
+    // 左右の端をまたぐ線分は端で分ける
+    if ((x1 < 0 && x2 > 0) || (x1 > 0 && x2 < 0)) {
+        const int32_t yc = y_at(0);
+        RenderClipped(x1, y1, 0, yc);
+        RenderClipped(0, yc, x2, y2);
+        return;
+    }
+    if ((x1 < right && x2 > right) || (x1 > right && x2 < right)) {
+        const int32_t yc = y_at(right);
+        RenderClipped(x1, y1, right, yc);
+        RenderClipped(right, yc, x2, y2);
+        return;
+    }
+    // 左側の外は左端の縦線と同じ寄与（右側のすべての画素を覆う）
+    if (x1 <= 0 && x2 <= 0) {
+        RenderScanline(0, y1, 0, y2);
+        return;
+    }
+    // 右側の外は描画範囲内の画素に影響しない
+    if (x1 >= right && x2 >= right) return;
+    RenderScanline(x1, y1, x2, y2);
+}
+
+void Rasterizer::AddCell(int ex, int32_t cover, int32_t area) {
+    Cell& c = cells_[static_cast<size_t>(ex)];
+    c.cover += cover;
+    c.area += area;
+    cell_min_ = std::min(cell_min_, ex);
+    cell_max_ = std::max(cell_max_, ex);
+}
+
+void Rasterizer::RenderScanline(int64_t x1, int32_t y1, int64_t x2, int32_t y2) {
+    // FreeType の gray ラスタライザの gray_render_scanline と同じ手順
+    int ex1 = static_cast<int>(x1 >> kSubpixelBits);
+    const int ex2 = static_cast<int>(x2 >> kSubpixelBits);
+    const int32_t fx1 = static_cast<int32_t>(x1 - (static_cast<int64_t>(ex1) << kSubpixelBits));
+    const int32_t fx2 = static_cast<int32_t>(x2 - (static_cast<int64_t>(ex2) << kSubpixelBits));
+
+    // 1つのセルに収まる場合
+    if (ex1 == ex2) {
+        const int32_t delta = y2 - y1;
+        AddCell(ex1, delta, (fx1 + fx2) * delta);
+        return;
+    }
+
+    // 横に並ぶセルをまたぐ場合は、各セルの境界での y を整数演算で進める
+    int64_t dx = x2 - x1;
+    int64_t p = static_cast<int64_t>(kOne - fx1) * (y2 - y1);
+    int32_t first = kOne;
+    int incr = 1;
+    if (dx < 0) {
+        p = static_cast<int64_t>(fx1) * (y2 - y1);
+        first = 0;
+        incr = -1;
+        dx = -dx;
+    }
+
+    int32_t delta = static_cast<int32_t>(p / dx);
+    int64_t mod = p % dx;
+    if (mod < 0) {
+        --delta;
+        mod += dx;
+    }
+    AddCell(ex1, delta, (fx1 + first) * delta);
+    ex1 += incr;
+    y1 += delta;
+
+    if (ex1 != ex2) {
+        p = static_cast<int64_t>(kOne) * (y2 - y1 + delta);
+        int32_t lift = static_cast<int32_t>(p / dx);
+        int64_t rem = p % dx;
+        if (rem < 0) {
+            --lift;
+            rem += dx;
+        }
+        mod -= dx;
+        while (ex1 != ex2) {
+            delta = lift;
+            mod += rem;
+            if (mod >= 0) {
+                mod -= dx;
+                ++delta;
+            }
+            AddCell(ex1, delta, kOne * delta);
+            y1 += delta;
+            ex1 += incr;
+        }
+    }
+    delta = y2 - y1;
+    AddCell(ex2, delta, (fx2 + kOne - first) * delta);
+}
+
+bool Rasterizer::SweepRow(uint16_t* row, uint16_t rgb565, FillRule rule, uint8_t opacity,
+                          int* x_min, int* x_max) {
+    if (cell_max_ < 0) return false;
+
+    // 左から巻き数を累積し、各画素の被覆率（0〜255）を求める
+    int first = -1, last = -1;
+    int32_t cover = 0;
+    for (int x = cell_min_; x < row_width_; ++x) {
+        if (x > cell_max_ && cover == 0) break;
+        const Cell& c = cells_[static_cast<size_t>(x)];
+        cover += c.cover;
+        int32_t a = cover * (kOne * 2) - c.area;
+        if (a < 0) a = -a;
+        int32_t coverage = a >> (kSubpixelBits * 2 + 1 - 8);  // 0〜256（重なりで超える）
+        if (rule == FillRule::kEvenOdd) {
+            coverage &= 511;
+            if (coverage > 256) coverage = 512 - coverage;
+        }
+        uint32_t alpha = static_cast<uint32_t>(std::min(coverage, 255));
+        if (opacity != 255) alpha = util::Div255(alpha * opacity);
+        alpha_[static_cast<size_t>(x)] = static_cast<uint8_t>(alpha);
+        if (alpha != 0) {
+            if (first < 0) first = x;
+            last = x;
+        }
+    }
+    std::fill(cells_.begin() + cell_min_, cells_.begin() + cell_max_ + 1, Cell{0, 0});
+    if (first < 0) return false;
+
+    // 被覆率が 0 / 255 / 中間 のいずれかで続く区間ごとに書き込む
+    for (int x = first; x <= last;) {
+        const uint8_t a = alpha_[static_cast<size_t>(x)];
+        int end = x + 1;
+        if (a == 0) {
+            while (end <= last && alpha_[static_cast<size_t>(end)] == 0) ++end;
+        } else if (a == 255) {
+            while (end <= last && alpha_[static_cast<size_t>(end)] == 255) ++end;
+            std::fill(row + x, row + end, rgb565);
+        } else {
+            while (end <= last && alpha_[static_cast<size_t>(end)] != 0 &&
+                   alpha_[static_cast<size_t>(end)] != 255) {
+                ++end;
+            }
+            util::Blend565Over(alpha_.data() + x, rgb565, row + x, row + x,
+                               static_cast<size_t>(end - x));
+        }
+        x = end;
+    }
+    *x_min = first;
+    *x_max = last;
+    return true;
+}
+
+}  // namespace display
@@ -0,0 +1,124 @@
+#include "display/rle_icon.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "util/blend565.h"
+#include "util/byte_swap.h"
+
+namespace ui {
+
+namespace {
+
+#if defined(CYCOM_HAVE_RLE_ICONS)
+// kRleIcons / kRleIconCount を定義する生成ファイル（cycom_icon_rle の出力）
+#include "rle_icon_data.inc"
+#else
+constexpr const RleIcon* kRleIcons = nullptr;
+constexpr size_t kRleIconCount = 0;
+#endif
+
+/**
+ * @brief 透明でないランの clip 内の部分ごとに fn(種類, 行, 列, 画素数, 色, 不透明度) を呼ぶ
+ *
+ * 色と不透明度は可視部分の先頭を指す（単色のランは色1つ、不透明度は半透明のランのみ）。
+ */
+template <typename Fn>
+void ForEachRun(const RleIcon& icon, int x, int y, const display::Rect& clip, Fn&& fn) {
+    const int row_begin = std::max(y, clip.y);
+    const int row_end = std::min(y + icon.height, clip.Bottom());
+    if (row_begin >= row_end || x >= clip.Right() || x + icon.width <= clip.x) return;
+
+    const uint16_t* color = icon.colors;
+    const uint8_t* alpha = icon.alphas;
+    int row = y;
+    int px = x;
+    for (size_t i = 0; i < icon.op_count && row < row_end; ++i) {
+        const RleOp kind = static_cast<RleOp>(icon.ops[i] >> 6);
+        const int n = (icon.ops[i] & 0x3F) + 1;
+        if (row >= row_begin && kind != RleOp::kSkip) {
+            const int a = std::max(px, clip.x);
+            const int b = std::min(px + n, clip.Right());
+            if (a < b) {
+                fn(kind, row, a, b - a, kind == RleOp::kSolid ? color : color + (a - px),
+                   kind == RleOp::kAlpha ? alpha + (a - px) : nullptr);
+            }
+        }
+        switch (kind) {
+        case RleOp::kSolid: color += 1; break;
+        case RleOp::kCopy: color += n; break;
+        case RleOp::kAlpha:
+            color += n;
+            alpha += n;
+            break;
+        case RleOp::kSkip:
+        default: break;
+        }
+        px += n;
+        if (px >= x + icon.width) {
+            px = x;
+            ++row;
+        }
+    }
+}
+
+}  // namespace
+
+const RleIcon* FindRleIcon(const char* name) {
+    if (!name) return nullptr;
+    for (size_t i = 0; i < kRleIconCount; ++i) {
+        if (std::strcmp(kRleIcons[i].name, name) == 0) return &kRleIcons[i];
+    }
+    return nullptr;
+}
+
+template <driver::PixelOrder O>
+void BlitRleIcon(const RleIcon& icon, uint16_t* dst, int stride, int x, int y,
+                 const display::Rect& clip) {
+    constexpr bool kPanel = O == driver::PixelOrder::kPanel;
+    ForEachRun(icon, x, y, clip,
+               [&](RleOp kind, int row, int col, int n, const uint16_t* c, const uint8_t* a) {
+        uint16_t* d = dst + static_cast<size_t>(row) * stride + col;
+        switch (kind) {
+        case RleOp::kSolid:
+            std::fill(d, d + n, kPanel ? util::Swap16(*c) : *c);
+            break;
+        case RleOp::kCopy:
+            if (kPanel) {
+                util::SwapBytes16(c, d, static_cast<size_t>(n));
+            } else {
+                std::memcpy(d, c, static_cast<size_t>(n) * 2);
+            }
+            break;
+        case RleOp::kAlpha:
+            for (int i = 0; i < n; ++i) {
+                const uint16_t bg = kPanel ? util::Swap16(d[i]) : d[i];
+                const uint16_t v = util::Blend565(bg, c[i], a[i]);
+                d[i] = kPanel ? util::Swap16(v) : v;
+            }
+            break;
+        case RleOp::kSkip:
+        default: break;
+        }
+    });
+}
+
+template void BlitRleIcon<driver::PixelOrder::kHost>(const RleIcon&, uint16_t*, int, int, int,
+                                                     const display::Rect&);
+template void BlitRleIcon<driver::PixelOrder::kPanel>(const RleIcon&, uint16_t*, int, int, int,
+                                                      const display::Rect&);
+
+void EraseRleIcon(const RleIcon& icon, uint16_t* dst, int stride, int x, int y,
+                  const display::Rect& clip, const uint16_t* layer, uint16_t fill) {
+    ForEachRun(icon, x, y, clip, [&](RleOp, int row, int col, int n, const uint16_t*,
+                                     const uint8_t*) {
+        const size_t off = static_cast<size_t>(row) * stride + col;
+        if (layer) {
+            std::memcpy(dst + off, layer + off, static_cast<size_t>(n) * 2);
+        } else {
+            std::fill(dst + off, dst + off + n, fill);
+        }
+    });
+}
+
+}  // namespace ui
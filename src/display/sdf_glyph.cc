@@ -0,0 +1,148 @@
+#include "display/sdf_glyph.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace ui {
+
+SdfGlyphCache::SdfGlyphCache(size_t budget_bytes) : fields_(budget_bytes) {}
+
+const uint8_t* SdfGlyphCache::buildField(FT_Face face, uint32_t cp, int size_px) {
+    constexpr int kRasterPx = kBasePx * kOversample;
+    constexpr int kPad = kSpreadPx;                  // 距離場の余白（基準サイズ）
+    constexpr int kSearch = kSpreadPx * kOversample;  // 探索半径（ラスタ画素）
+
+    FT_Set_Pixel_Sizes(face, 0, kRasterPx);
+    const FT_Error err = FT_Load_Char(face, cp, FT_LOAD_RENDER | FT_LOAD_NO_HINTING);
+    FieldHeader h{};
+    int rw = 0, rh = 0;
+    if (err == 0) {
+        const FT_GlyphSlot slot = face->glyph;
+        const FT_Bitmap& bmp = slot->bitmap;
+        rw = static_cast<int>(bmp.width);
+        rh = static_cast<int>(bmp.rows);
+        // 2値化したラスタ（内側 = 1）
+        raster_.assign(static_cast<size_t>(rw) * rh, 0);
+        for (int y = 0; y < rh; ++y) {
+            const unsigned char* row = bmp.buffer + static_cast<long>(y) * bmp.pitch;
+            for (int x = 0; x < rw; ++x) raster_[static_cast<size_t>(y) * rw + x] = row[x] >= 128;
+        }
+        // ラスタ座標を基準サイズへ（左上を切り下げ、余白を足す）
+        const double os = kOversample;
+        const int left_b = static_cast<int>(std::floor(slot->bitmap_left / os));
+        const int top_b = static_cast<int>(std::ceil(slot->bitmap_top / os));
+        const int right_b = static_cast<int>(std::ceil((slot->bitmap_left + rw) / os));
+        const int bottom_b = static_cast<int>(std::floor((slot->bitmap_top - rh) / os));
+        if (rw > 0 && rh > 0) {
+            h.width = static_cast<int16_t>(right_b - left_b + 2 * kPad);
+            h.height = static_cast<int16_t>(top_b - bottom_b + 2 * kPad);
+            h.left = static_cast<int16_t>(left_b - kPad);
+            h.top = static_cast<int16_t>(top_b + kPad);
+        }
+        h.advance_16_16 = static_cast<int32_t>(slot->linearHoriAdvance / kOversample);
+        h.index = slot->glyph_index;
+
+        // 距離場の原点（左上）をラスタ座標で表したもの
+        const int origin_x = h.left * kOversample - slot->bitmap_left;
+        const int origin_y = slot->bitmap_top - h.top * kOversample;
+        auto inside = [&](int x, int y) {
+            return x >= 0 && y >= 0 && x < rw && y < rh && raster_[static_cast<size_t>(y) * rw + x];
+        };
+
+        const size_t n = static_cast<size_t>(h.width) * h.height;
+        uint8_t* field = fields_.Insert(cp, sizeof(FieldHeader) + n);
+        if (!field) {
+            FT_Set_Pixel_Sizes(face, 0, size_px);
+            return nullptr;
+        }
+        std::memcpy(field, &h, sizeof(h));
+        uint8_t* dst = field + sizeof(h);
+        for (int ty = 0; ty < h.height; ++ty) {
+            for (int tx = 0; tx < h.width; ++tx) {
+                // テクセル中心に最も近いラスタ画素
+                const int cx = origin_x + tx * kOversample + kOversample / 2;
+                const int cy = origin_y + ty * kOversample + kOversample / 2;
+                const bool in = inside(cx, cy);
+                int best = kSearch * kSearch;
+                for (int dy = -kSearch; dy <= kSearch; ++dy) {
+                    for (int dx = -kSearch; dx <= kSearch; ++dx) {
+                        const int d2 = dx * dx + dy * dy;
+                        if (d2 < best && inside(cx + dx, cy + dy) != in) best = d2;
+                    }
+                }
+                // 境界は隣り合う画素の中間にあるとみなす
+                double d = (std::sqrt(double(best)) - 0.5) / kOversample;
+                if (!in) d = -d;
+                const int v = static_cast<int>(std::lround(128.0 + d * 127.0 / kSpreadPx));
+                dst[static_cast<size_t>(ty) * h.width + tx] =
+                    static_cast<uint8_t>(std::clamp(v, 0, 255));
+            }
+        }
+        FT_Set_Pixel_Sizes(face, 0, size_px);
+        return field;
+    }
+    FT_Set_Pixel_Sizes(face, 0, size_px);
+    return nullptr;
+}
+
+void SdfGlyphCache::updateCoverageTable(int size_px) {
+    if (lut_size_px_ == size_px) return;
+    lut_size_px_ = size_px;
+    // 値 v の距離（描画サイズのピクセル）を求め、輪郭の前後1ピクセルを smoothstep でぼかす
+    const double px_per_unit = double(kSpreadPx) / 127.0 * size_px / kBasePx;
+    for (int v = 0; v < 256; ++v) {
+        const double d = (v - 128) * px_per_unit;
+        const double t = std::clamp(d + 0.5, 0.0, 1.0);
+        coverage_[v] = static_cast<uint8_t>(std::lround(255.0 * t * t * (3.0 - 2.0 * t)));
+    }
+}
+
+bool SdfGlyphCache::Render(FT_Face face, uint32_t cp, int size_px, SdfBitmap& out) {
+    const uint8_t* field = fields_.Find(cp);
+    if (!field) field = buildField(face, cp, size_px);
+    if (!field) return false;
+
+    FieldHeader h;
+    std::memcpy(&h, field, sizeof(h));
+    const uint8_t* sdf = field + sizeof(h);
+    updateCoverageTable(size_px);
+
+    const double s = double(size_px) / kBasePx;
+    out = SdfBitmap{};
+    out.index = h.index;
+    out.advance = static_cast<int>(std::lround(h.advance_16_16 / 65536.0 * s));
+    if (h.width <= 0 || h.height <= 0) return true;
+
+    out.left = static_cast<int>(std::floor(h.left * s));
+    out.top = static_cast<int>(std::ceil(h.top * s));
+    out.width = static_cast<int>(std::ceil((h.left + h.width) * s)) - out.left;
+    out.height = out.top - static_cast<int>(std::floor((h.top - h.height) * s));
+    out_.resize(static_cast<size_t>(out.width) * out.height);
+
+    // 出力画素中心 → 距離場座標（8bit固定小数点）の対応を列・行ごとに求める
+    const int fx_max = (h.width - 1) << 8, fy_max = (h.height - 1) << 8;
+    col_.resize(static_cast<size_t>(out.width));
+    for (int x = 0; x < out.width; ++x) {
+        const double u = (out.left + x + 0.5) / s - h.left - 0.5;
+        col_[x] = std::clamp(static_cast<int>(std::lround(u * 256.0)), 0, fx_max);
+    }
+    for (int y = 0; y < out.height; ++y) {
+        const double v = h.top - (out.top - y - 0.5) / s - 0.5;
+        const int fy = std::clamp(static_cast<int>(std::lround(v * 256.0)), 0, fy_max);
+        const int y0 = fy >> 8, y1 = std::min(y0 + 1, h.height - 1), wy = fy & 0xFF;
+        const uint8_t* r0 = sdf + static_cast<size_t>(y0) * h.width;
+        const uint8_t* r1 = sdf + static_cast<size_t>(y1) * h.width;
+        uint8_t* dst = out_.data() + static_cast<size_t>(y) * out.width;
+        for (int x = 0; x < out.width; ++x) {
+            const int x0 = col_[x] >> 8, x1 = std::min(x0 + 1, h.width - 1), wx = col_[x] & 0xFF;
+            const int top = r0[x0] * (256 - wx) + r0[x1] * wx;
+            const int bot = r1[x0] * (256 - wx) + r1[x1] * wx;
+            dst[x] = coverage_[(top * (256 - wy) + bot * wy + (1 << 15)) >> 16];
+        }
+    }
+    out.alpha = out_.data();
+    return true;
+}
+
+}  // namespace ui
@@ -3,18 +3,9 @@
 #include <cstring>
 #include <stdexcept>
 
-namespace ui {
+#include "util/blend565.h"
 
-inline uint16_t TextRenderer::Blend565(uint16_t bg, uint16_t fg, uint8_t a) {
-    auto ex = [](uint16_t c, int sh, int m)->int { return (c >> sh) & m; };
-    int br = ex(bg, 11, 0x1F), bgc = ex(bg, 5, 0x3F), bb = ex(bg, 0, 0x1F);
-    int fr = ex(fg, 11, 0x1F), fgc = ex(fg, 5, 0x3F), fb = ex(fg, 0, 0x1F);
-    int inv = 255 - a;
-    int r = (fr * a + br * inv) / 255;
-    int g = (fgc * a + bgc * inv) / 255;
-    int b = (fb * a + bb * inv) / 255;
-    return static_cast<uint16_t>((r << 11) | (g << 5) | b);
-}
+namespace ui {
 
 bool TextRenderer::NextCodepoint(const std::string& s, size_t& i, uint32_t& cp) {
     if (i >= s.size()) return false;
@@ -46,14 +37,26 @@ bool TextRenderer::NextCodepoint(const std::string& s, size_t& i, uint32_t& cp)
 }
 
 TextRenderer::TextRenderer(driver::IDisplay& lcd, const std::string& font_path)
+    : TextRenderer(lcd, FontSource::File(font_path)) {}
+
+TextRenderer::TextRenderer(driver::IDisplay& lcd, const FontSource& font)
     : lcd_(lcd)
 {
     if (FT_Init_FreeType(&ft_) != 0) throw std::runtime_error("FT_Init_FreeType failed");
-    if (FT_New_Face(ft_, font_path.c_str(), 0, &face_) != 0) {
+    FT_Error err = 0;
+    if (font.data) {
+        // ディスクを読まずにマップ済みのフォントデータから直接生成する
+        err = FT_New_Memory_Face(ft_, font.data, static_cast<FT_Long>(font.size), 0, &face_);
+    } else {
+        err = FT_New_Face(ft_, font.path.c_str(), 0, &face_);
+    }
+    if (err != 0) {
         FT_Done_FreeType(ft_); ft_ = nullptr;
-        throw std::runtime_error("FT_New_Face failed: " + font_path);
+        throw std::runtime_error("FT_New_Face failed: " +
+                                 (font.data ? std::string("<memory>") : font.path));
     }
     FT_Set_Pixel_Sizes(face_, 0, font_size_px_);
+    selectPrebuiltGlyphs();
 }
 
 TextRenderer::~TextRenderer() {
@@ -62,136 +65,414 @@ TextRenderer::~TextRenderer() {
 }
 
 void TextRenderer::SetFontSizePx(int px) {
-    font_size_px_ = std::max(6, px);
+    font_size_px_ = std::clamp(px, 6, kMaxFontSizePx);
     FT_Set_Pixel_Sizes(face_, 0, font_size_px_);
+    selectPrebuiltGlyphs();
+}
+
+void TextRenderer::SetGlyphMode(GlyphMode mode) {
+    // 合成済みグリフのキーは生成方式を含まないため、切り替えたら作り直す
+    if (mode != mode_) rendered_cache_.Clear();
+    mode_ = mode;
+}
+
+void TextRenderer::SetGlyphAtlas(const GlyphAtlas* atlas) {
+    atlas_ = atlas;
+    selectPrebuiltGlyphs();
+}
+
+void TextRenderer::selectPrebuiltGlyphs() {
+    baked_ = FindBakedFont(face_->family_name, face_->style_name, font_size_px_);
+    atlas_face_ = GlyphAtlasView{};
+    if (atlas_) {
+        atlas_->FindFace(face_->family_name, face_->style_name, font_size_px_, atlas_face_);
+    }
 }
 
 void TextRenderer::SetColors(Color565 fg, Color565 bg) { fg_ = fg; bg_ = bg; }
 void TextRenderer::SetLineGapPx(int px) { line_gap_px_ = std::max(0, px); }
 void TextRenderer::SetWrapWidthPx(int px) { wrap_width_px_ = std::max(0, px); }
+void TextRenderer::SetTabularFigures(bool on) { tabular_ = on; }
+void TextRenderer::SetBackgroundLayer(const display::SurfaceView& layer) { layer_ = layer; }
+
+void TextRenderer::SetGlyphCacheBudget(size_t alpha_bytes, size_t rendered_bytes) {
+    alpha_cache_.SetBudget(alpha_bytes);
+    rendered_cache_.SetBudget(rendered_bytes);
+}
+
+void TextRenderer::SetLabelCacheBudget(size_t bytes) {
+    label_cache_.SetBudget(bytes);
+}
+
+GlyphCacheStats TextRenderer::CacheStats() const {
+    return GlyphCacheStats{alpha_cache_.GetStats(), rendered_cache_.GetStats(), baked_hits_,
+                           atlas_hits_, sdf_.GetStats(), label_cache_.GetStats()};
+}
 
 TextRenderer::Glyph TextRenderer::loadGlyph(uint32_t cp) {
-    Glyph g;
-    if (FT_Load_Char(face_, cp, FT_LOAD_RENDER) != 0) return g;
-    FT_GlyphSlot slot = face_->glyph;
-    const FT_Bitmap& bmp = slot->bitmap;
-
-    g.width = bmp.width;
-    g.height = bmp.rows;
-    g.left = slot->bitmap_left;
-    g.top = slot->bitmap_top;
-    g.advance = (slot->advance.x >> 6);
-    g.pitch = bmp.pitch;
-
-    if (g.width > 0 && g.height > 0) {
-        g.alpha.resize(g.height * g.pitch);
-        std::memcpy(g.alpha.data(), bmp.buffer, g.alpha.size());
+    GlyphHeader h{};
+    const uint8_t* bitmap = nullptr;
+    size_t bitmap_bytes = 0;
+    if (FT_Load_Char(face_, cp, FT_LOAD_RENDER) == 0) {
+        FT_GlyphSlot slot = face_->glyph;
+        const FT_Bitmap& bmp = slot->bitmap;
+        h.width = static_cast<int16_t>(bmp.width);
+        h.height = static_cast<int16_t>(bmp.rows);
+        h.left = static_cast<int16_t>(slot->bitmap_left);
+        h.top = static_cast<int16_t>(slot->bitmap_top);
+        h.advance = static_cast<int16_t>(slot->advance.x >> 6);
+        h.pitch = static_cast<int16_t>(bmp.pitch);
+        h.index = slot->glyph_index;
+        if (h.width > 0 && h.height > 0) {
+            bitmap = bmp.buffer;
+            bitmap_bytes = static_cast<size_t>(h.height) * h.pitch;
+        }
+    }
+
+    Glyph g{h.width, h.height, h.left, h.top, h.advance, h.pitch, h.index, nullptr};
+    // 読み込みに失敗したグリフも空として記録し、毎回 FreeType を呼ばないようにする
+    uint8_t* p = alpha_cache_.Insert(MakeKey(font_size_px_, cp),
+                                     sizeof(GlyphHeader) + bitmap_bytes);
+    if (p) {
+        std::memcpy(p, &h, sizeof(h));
+        if (bitmap_bytes > 0) std::memcpy(p + sizeof(h), bitmap, bitmap_bytes);
+        g.alpha = p + sizeof(h);
+    } else if (bitmap_bytes > 0) {
+        uncached_alpha_.assign(bitmap, bitmap + bitmap_bytes);
+        g.alpha = uncached_alpha_.data();
     }
     return g;
 }
 
-const TextRenderer::Glyph* TextRenderer::getGlyph(uint32_t cp) {
-    GlyphKey key = MakeKey(font_size_px_, cp);
-    auto it = cache_.find(key);
-    if (it != cache_.end()) return &it->second;
-    Glyph g = loadGlyph(cp);
-    auto [pos, _] = cache_.emplace(key, std::move(g));
-    return &pos->second;
+TextRenderer::Glyph TextRenderer::getGlyph(uint32_t cp) {
+    // 組み込み表にあればキャッシュも FreeType も使わない
+    if (baked_) {
+        if (const BakedGlyph* b = baked_->Find(cp)) {
+            ++baked_hits_;
+            return Glyph{b->width, b->height, b->left, b->top, b->advance, b->width, b->index,
+                         b->alpha};
+        }
+    }
+    if (const GlyphAtlasGlyph* a = atlas_face_.Find(cp)) {
+        ++atlas_hits_;
+        return Glyph{a->width, a->height, a->left, a->top, a->advance, atlas_face_.pitch, a->index,
+                     atlas_face_.Alpha(*a)};
+    }
+    if (mode_ == GlyphMode::kSdf) {
+        SdfBitmap b;
+        if (sdf_.Render(face_, cp, font_size_px_, b)) {
+            return Glyph{b.width, b.height, b.left, b.top, b.advance, b.width, b.index, b.alpha};
+        }
+    }
+    const uint8_t* p = alpha_cache_.Find(MakeKey(font_size_px_, cp));
+    if (!p) return loadGlyph(cp);
+    GlyphHeader h;
+    std::memcpy(&h, p, sizeof(h));
+    return Glyph{h.width, h.height, h.left, h.top, h.advance, h.pitch, h.index, p + sizeof(h)};
 }
 
-void TextRenderer::blitGlyph(int dst_x, int dst_y, const Glyph& g) {
-    if (g.width <= 0 || g.height <= 0) return;
+const uint16_t* TextRenderer::getRenderedGlyph(uint32_t cp, const Glyph& g) {
+    const GlyphKey key = MakeRenderedKey(font_size_px_, cp, fg_.value, bg_.value);
+    if (const uint8_t* p = rendered_cache_.Find(key)) {
+        return reinterpret_cast<const uint16_t*>(p);
+    }
+    const size_t n = static_cast<size_t>(g.width) * g.height;
+    uint16_t* px = reinterpret_cast<uint16_t*>(rendered_cache_.Insert(key, n * sizeof(uint16_t)));
+    if (!px) return nullptr;
+    for (int y = 0; y < g.height; ++y) {
+        const uint8_t* src = g.alpha + y * g.pitch;
+        uint16_t* dst = px + static_cast<size_t>(y) * g.width;
+        util::Blend565Span(src, fg_.value, bg_.value, dst, g.width);
+    }
+    return px;
+}
+
+void TextRenderer::blitGlyph(int dst_x, int dst_y, uint32_t cp, const Glyph& g) {
+    if (g.width <= 0 || g.height <= 0 || !g.alpha) return;
     int x0 = dst_x + g.left;
     int y0 = dst_y - g.top;
 
-    // 1ラインずつα合成して送る
-    std::vector<uint16_t> line(g.width);
+    if (!layer_.Valid()) {
+        // 単色背景なら合成済みグリフを1矩形で送る（色が同じ限り再合成しない）
+        if (const uint16_t* px = getRenderedGlyph(cp, g)) {
+            lcd_.DrawRGB565Rect(x0, y0, g.width, g.height, px, g.width,
+                                driver::PixelOrder::kHost);
+            return;
+        }
+    }
+
+    // 1ラインずつα合成して送る（背景レイヤがあればその画素、なければ bg_ に対して合成）
+    line_.resize(g.width);
     for (int y = 0; y < g.height; ++y) {
-        const uint8_t* src = g.alpha.data() + y * g.pitch;
-        for (int x = 0; x < g.width; ++x) {
-            uint8_t a = src[x];
-            line[x] = Blend565(bg_.value, fg_.value, a);
+        const uint8_t* src = g.alpha + y * g.pitch;
+        const int ly = y0 + y;
+        std::fill(line_.begin(), line_.end(), bg_.value);
+        if (layer_.Valid() && ly >= 0 && ly < layer_.height) {
+            const int lx0 = std::max(0, x0), lx1 = std::min(layer_.width, x0 + g.width);
+            if (lx0 < lx1) {
+                std::memcpy(line_.data() + (lx0 - x0), layer_.Row(ly) + lx0,
+                            static_cast<size_t>(lx1 - lx0) * sizeof(uint16_t));
+            }
         }
-        lcd_.DrawRGB565Line(x0, y0 + y, line.data(), g.width);
+        util::Blend565Over(src, fg_.value, line_.data(), line_.data(), g.width);
+        lcd_.DrawRGB565Line(x0, ly, line_.data(), g.width);
     }
 }
 
-TextMetrics TextRenderer::DrawText(int x, int y, const std::string& utf8) {
-    int pen_x = x, pen_y = y;
+int TextRenderer::digitCellWidth() {
+    int cell = 0;
+    for (uint32_t cp = '0'; cp <= '9'; ++cp) cell = std::max(cell, getGlyph(cp).advance);
+    return cell;
+}
+
+TextRenderer::Layout TextRenderer::buildLayout(const std::string& utf8) {
+    Layout L;
     int ascent = (face_->size->metrics.ascender >> 6);
     int descent = -(face_->size->metrics.descender >> 6);
     int line_h = (face_->size->metrics.height >> 6);
     if (line_h <= 0) line_h = ascent + descent + line_gap_px_;
 
-    int wrap_w = wrap_width_px_;
-    int cur_w = 0, max_w = 0, total_h = line_h;
+    const bool kerning = FT_HAS_KERNING(face_);
+    const int cell = tabular_ ? digitCellWidth() : 0;
+    auto is_digit = [](uint32_t cp) { return cp >= '0' && cp <= '9'; };
+
+    int pen_x = 0, pen_y = 0;
+    int max_w = 0, total_h = line_h;
+    uint32_t prev_index = 0, prev_cp = 0;
+
+    auto new_line = [&]() {
+        max_w = std::max(max_w, pen_x);
+        pen_x = 0;
+        pen_y += line_h + line_gap_px_;
+        total_h += line_h + line_gap_px_;
+        prev_index = 0;
+    };
 
     size_t i = 0;
     while (i < utf8.size()) {
         uint32_t cp;
         if (!NextCodepoint(utf8, i, cp)) break;
-
         if (cp == '\n') {
-            max_w = std::max(max_w, cur_w);
-            pen_x = x;
-            pen_y += line_h + line_gap_px_;
-            total_h += line_h + line_gap_px_;
-            cur_w = 0;
+            new_line();
             continue;
         }
 
-        const Glyph* g = getGlyph(cp);
-        int adv = (g ? g->advance : font_size_px_ / 2);
-        if (wrap_w > 0 && (pen_x - x + adv) > wrap_w) {
-            max_w = std::max(max_w, cur_w);
-            pen_x = x;
-            pen_y += line_h + line_gap_px_;
-            total_h += line_h + line_gap_px_;
-            cur_w = 0;
-        }
+        const Glyph g = getGlyph(cp);
+        const bool tab_digit = tabular_ && is_digit(cp);
+        const int adv = tab_digit ? cell : g.advance;
 
-        if (g) {
-            blitGlyph(pen_x, pen_y, *g);
-            pen_x += g->advance;
-            cur_w += g->advance;
+        // 等幅数字の前後ではカーニングを掛けない（桁位置を固定するため）
+        if (kerning && prev_index && g.index &&
+            !(tabular_ && (tab_digit || is_digit(prev_cp)))) {
+            FT_Vector delta;
+            if (FT_Get_Kerning(face_, prev_index, g.index, FT_KERNING_DEFAULT, &delta) == 0) {
+                pen_x += static_cast<int>(delta.x >> 6);
+            }
         }
+        if (wrap_width_px_ > 0 && pen_x > 0 && pen_x + adv > wrap_width_px_) new_line();
+
+        // 等幅セル内ではグリフを中央に置く
+        const int x = tab_digit ? pen_x + (cell - g.advance) / 2 : pen_x;
+        L.glyphs.push_back(PlacedGlyph{cp, x, pen_y});
+        pen_x += adv;
+        prev_index = g.index;
+        prev_cp = cp;
     }
-    max_w = std::max(max_w, cur_w);
+    max_w = std::max(max_w, pen_x);
 
-    return TextMetrics{max_w, total_h, ascent};
+    L.metrics = TextMetrics{max_w, total_h, ascent};
+    L.block_h = pen_y + ascent + descent;
+    return L;
 }
 
-TextMetrics TextRenderer::MeasureText(const std::string& utf8) const {
-    int cur_w = 0, max_w = 0;
-    int ascent = (face_->size->metrics.ascender >> 6);
-    int line_h = (face_->size->metrics.height >> 6);
-    if (line_h <= 0) line_h = font_size_px_ + line_gap_px_;
+const TextRenderer::Layout& TextRenderer::getLayout(const std::string& utf8) {
+    // 配置結果に影響する条件をキーの先頭に含める
+    std::string key;
+    key.reserve(utf8.size() + 4 * sizeof(int));
+    const int params[4] = {font_size_px_, wrap_width_px_, line_gap_px_, tabular_ ? 1 : 0};
+    key.append(reinterpret_cast<const char*>(params), sizeof(params));
+    key += utf8;
 
-    size_t i = 0;
-    while (i < utf8.size()) {
-        uint32_t cp;
-        if (!NextCodepoint(utf8, i, cp)) break;
-        if (cp == '\n') { max_w = std::max(max_w, cur_w); cur_w = 0; continue; }
-        cur_w += static_cast<int>(font_size_px_ * 0.6); // 概算
+    auto it = layout_index_.find(key);
+    if (it != layout_index_.end()) {
+        layouts_.splice(layouts_.begin(), layouts_, it->second);
+        return it->second->second;
+    }
+
+    Layout L = buildLayout(utf8);
+    if (layouts_.size() >= kMaxCachedLayouts) {
+        layout_index_.erase(layouts_.back().first);
+        layouts_.pop_back();
+    }
+    layouts_.emplace_front(key, std::move(L));
+    layout_index_.emplace(std::move(key), layouts_.begin());
+    return layouts_.front().second;
+}
+
+template <typename Emit>
+TextMetrics TextRenderer::layoutText(int x, int y, const std::string& utf8, Emit&& emit) {
+    const Layout& L = getLayout(utf8);
+    for (const PlacedGlyph& pg : L.glyphs) {
+        emit(x + pg.x, y + pg.y, pg.cp, getGlyph(pg.cp));
+    }
+    return L.metrics;
+}
+
+TextMetrics TextRenderer::DrawText(int x, int y, const std::string& utf8) {
+    return layoutText(x, y, utf8, [this](int px, int py, uint32_t cp, const Glyph& g) {
+        blitGlyph(px, py, cp, g);
+    });
+}
+
+TextMetrics TextRenderer::MeasureText(const std::string& utf8) {
+    return getLayout(utf8).metrics;
+}
+
+void TextRenderer::composeGlyph(int pen_x, int pen_y, uint32_t cp, const Glyph& g,
+                                int origin_x, int origin_y, int w, int h) {
+    if (g.width <= 0 || g.height <= 0 || !g.alpha) return;
+    // 作業バッファ内の座標へ変換し、はみ出す部分は切り取る
+    const int gx = pen_x + g.left - origin_x;
+    const int gy = pen_y - g.top - origin_y;
+    const int x_begin = std::max(0, -gx), x_end = std::min(g.width, w - gx);
+    const int y_begin = std::max(0, -gy), y_end = std::min(g.height, h - gy);
+    if (x_begin >= x_end || y_begin >= y_end) return;
+
+    // まだ bg_ のままの行（単色背景や、背景レイヤの単色の部分）には合成済みグリフ（2段目）を
+    // そのまま写す（合成済みグリフは初めて必要になった行で取得する）
+    const uint16_t* rendered = nullptr;
+    bool rendered_tried = false;
+    const int n = x_end - x_begin;
+    for (int y = y_begin; y < y_end; ++y) {
+        const uint8_t* src = g.alpha + y * g.pitch + x_begin;
+        uint16_t* dst = label_buf_.data() + static_cast<size_t>(gy + y) * w + gx + x_begin;
+        const bool plain =
+            std::all_of(dst, dst + n, [this](uint16_t p) { return p == bg_.value; });
+        if (plain && !rendered_tried) {
+            rendered = getRenderedGlyph(cp, g);
+            rendered_tried = true;
+        }
+        if (plain && rendered) {
+            std::memcpy(dst, rendered + static_cast<size_t>(y) * g.width + x_begin,
+                        static_cast<size_t>(n) * sizeof(uint16_t));
+        } else {
+            // 背景や先に置いたグリフの上に合成する
+            util::Blend565Over(src, fg_.value, dst, dst, n);
+        }
+    }
+}
+
+void TextRenderer::makeLabelKey(int x, int y, int w, int h, bool center,
+                                const std::string& utf8) {
+    // 組み立て結果に影響する条件をすべて含める（背景レイヤは参照先と内容の版で識別する）
+    const int64_t params[] = {
+        x, y, w, h, font_size_px_, fg_.value, bg_.value, center ? 1 : 0, tabular_ ? 1 : 0,
+        wrap_width_px_, line_gap_px_, static_cast<int64_t>(mode_),
+        layer_.Valid() ? static_cast<int64_t>(reinterpret_cast<uintptr_t>(layer_.pixels)) : 0,
+        layer_.Valid() ? static_cast<int64_t>(layer_.version) : 0,
+    };
+    label_key_.assign(reinterpret_cast<const char*>(params), sizeof(params));
+    label_key_ += utf8;
+}
+
+uint64_t TextRenderer::HashKey(const std::string& key) {
+    // FNV-1a
+    uint64_t h = 1469598103934665603ull;
+    for (unsigned char c : key) {
+        h ^= c;
+        h *= 1099511628211ull;
     }
-    max_w = std::max(max_w, cur_w);
-    return TextMetrics{max_w, line_h, ascent};
+    return h;
 }
 
 TextMetrics TextRenderer::DrawLabel(int panel_x, int panel_y, int panel_w, int panel_h,
                                     const std::string& utf8, bool center) {
-    int x1{panel_x + panel_w - 1};
-    int y1{panel_y + panel_h - 1};
+    if (panel_w <= 0 || panel_h <= 0) return TextMetrics{0, 0, 0};
+
+    // 同じ組み立て結果があればそのまま転送する
+    makeLabelKey(panel_x, panel_y, panel_w, panel_h, center, utf8);
+    const uint64_t hash = HashKey(label_key_);
+    const size_t px_bytes = static_cast<size_t>(panel_w) * panel_h * sizeof(uint16_t);
+    if (const uint8_t* e = label_cache_.Find(hash)) {
+        LabelHeader hdr;
+        std::memcpy(&hdr, e, sizeof(hdr));
+        const uint8_t* px = e + sizeof(LabelHeader);
+        if (hdr.key_len == label_key_.size() && hdr.width == panel_w && hdr.height == panel_h &&
+            std::memcmp(px + px_bytes, label_key_.data(), label_key_.size()) == 0) {
+            lcd_.DrawRGB565Rect(panel_x, panel_y, panel_w, panel_h,
+                                reinterpret_cast<const uint16_t*>(px), panel_w,
+                                driver::PixelOrder::kHost);
+            return hdr.metrics;
+        }
+    }
+
+    int pen_x, pen_y;
+    labelOrigin(panel_x, panel_y, panel_w, panel_h, utf8, center, &pen_x, &pen_y);
+    const TextMetrics m = composeLabel(panel_x, panel_y, panel_w, panel_h, pen_x, pen_y, utf8);
+
+    const size_t entry_bytes = sizeof(LabelHeader) + px_bytes + label_key_.size();
+    if (uint8_t* e = label_cache_.Insert(hash, entry_bytes)) {
+        const LabelHeader hdr{static_cast<uint32_t>(label_key_.size()), panel_w, panel_h, m};
+        std::memcpy(e, &hdr, sizeof(hdr));
+        std::memcpy(e + sizeof(hdr), label_buf_.data(), px_bytes);
+        std::memcpy(e + sizeof(hdr) + px_bytes, label_key_.data(), label_key_.size());
+    }
+
+    lcd_.DrawRGB565Rect(panel_x, panel_y, panel_w, panel_h, label_buf_.data(), panel_w,
+                        driver::PixelOrder::kHost);
+    return m;
+}
+
+void TextRenderer::PlaceLabel(int panel_x, int panel_y, int panel_w, int panel_h,
+                              const std::string& utf8, bool center, LabelPlacement& out) {
+    labelOrigin(panel_x, panel_y, panel_w, panel_h, utf8, center, &out.pen_x, &out.pen_y);
+    const Layout& L = getLayout(utf8);
+    out.glyphs.clear();
+    for (const PlacedGlyph& pg : L.glyphs) {
+        out.glyphs.push_back(LabelPlacement::Glyph{pg.cp, out.pen_x + pg.x});
+    }
+    out.metrics = L.metrics;
+}
+
+void TextRenderer::DrawLabelPart(int part_x, int part_y, int part_w, int part_h,
+                                 int pen_x, int pen_y, const std::string& utf8) {
+    if (part_w <= 0 || part_h <= 0) return;
+    composeLabel(part_x, part_y, part_w, part_h, pen_x, pen_y, utf8);
+    lcd_.DrawRGB565Rect(part_x, part_y, part_w, part_h, label_buf_.data(), part_w,
+                        driver::PixelOrder::kHost);
+}
+
+void TextRenderer::labelOrigin(int x, int y, int w, int h, const std::string& utf8,
+                               bool center, int* pen_x, int* pen_y) {
     if (center) {
-        auto m = MeasureText(utf8);
-        int x = panel_x + std::max(0, (panel_w - m.width_px) / 2);
-        int y = panel_y + std::max(0, (panel_h + m.baseline_px) / 2);
-        return DrawText(x, y, utf8);
+        // 送り幅の合計と、アセンダ〜ディセンダの高さで中央に置く
+        const Layout& L = getLayout(utf8);
+        *pen_x = x + std::max(0, (w - L.metrics.width_px) / 2);
+        *pen_y = y + std::max(0, (h - L.block_h) / 2) + L.metrics.baseline_px;
     } else {
-        int x = panel_x + 4;
-        int y = panel_y + (font_size_px_ + 4);
-        return DrawText(x, y, utf8);
+        *pen_x = x + 4;
+        *pen_y = y + (font_size_px_ + 4);
+    }
+}
+
+TextMetrics TextRenderer::composeLabel(int x, int y, int w, int h, int pen_x, int pen_y,
+                                       const std::string& utf8) {
+    // 背景で作業バッファを満たす（レイヤがあればその画素、なければ bg_）
+    label_buf_.resize(static_cast<size_t>(w) * h);
+    for (int row_y = 0; row_y < h; ++row_y) {
+        uint16_t* row = label_buf_.data() + static_cast<size_t>(row_y) * w;
+        std::fill(row, row + w, bg_.value);
+        const int ly = y + row_y;
+        if (!layer_.Valid() || ly < 0 || ly >= layer_.height) continue;
+        const int x0 = std::max(0, x), x1 = std::min(layer_.width, x + w);
+        if (x0 < x1) {
+            std::memcpy(row + (x0 - x), layer_.Row(ly) + x0,
+                        static_cast<size_t>(x1 - x0) * sizeof(uint16_t));
+        }
     }
+    return layoutText(pen_x, pen_y, utf8, [&](int px, int py, uint32_t cp, const Glyph& g) {
+        composeGlyph(px, py, cp, g, x, y, w, h);
+    });
 }
 
-} // namespace ui
\ No newline at end of file
+} // namespace ui
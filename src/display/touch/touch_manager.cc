@@ -1,11 +1,25 @@
 #include "display/touch/touch_manager.h"
 #include <chrono>
+#include <cstdlib>
 #include <iostream>
 
 namespace display {
 
-TouchManager::TouchManager(driver::ITouch& touch)
-    : touch_(touch) {
+namespace {
+// スワイプとみなす横方向の最小移動量（縦方向の移動量の2倍以上も必要）
+constexpr int kSwipeMinPx = 60;
+
+/**
+ * @brief タッチ開始から離すまでの移動量をスワイプ通知に変換する（スワイプでなければ0）
+ */
+uint32_t SwipeEvent(int dx, int dy) {
+    if (std::abs(dx) < kSwipeMinPx || std::abs(dx) < 2 * std::abs(dy)) return 0;
+    return dx < 0 ? util::kUpdateSwipeLeft : util::kUpdateSwipeRight;
+}
+}  // namespace
+
+TouchManager::TouchManager(driver::ITouch& touch, util::UpdateNotifier* notifier)
+    : touch_(touch), notifier_(notifier) {
     // Logger / SensorManager / DisplayManager と同様、コンストラクタで自動的にスレッドを起動
     Start();
 }
@@ -44,17 +58,32 @@ void TouchManager::TouchLoop() {
     try {
         // 定期的にタッチコントローラをポーリング
         const auto POLL_INTERVAL = std::chrono::milliseconds(50);
+        int start_x = -1, start_y = -1;  // タッチ開始位置（スワイプ判定用）
         
         while (running_.load(std::memory_order_acquire)) {
             driver::TouchPoint point = touch_.GetTouchPoint();
             
-            if (point.touched) {
-                last_x_.store(point.x, std::memory_order_release);
-                last_y_.store(point.y, std::memory_order_release);
-            } else {
-                // タッチされていない場合は座標をクリア
-                last_x_.store(-1, std::memory_order_release);
-                last_y_.store(-1, std::memory_order_release);
+            // タッチされていない場合は座標をクリア
+            const int x = point.touched ? point.x : -1;
+            const int y = point.touched ? point.y : -1;
+            const int prev_x = last_x_.load(std::memory_order_relaxed);
+            const int prev_y = last_y_.load(std::memory_order_relaxed);
+            const bool changed = (x != prev_x || y != prev_y);
+            last_x_.store(x, std::memory_order_release);
+            last_y_.store(y, std::memory_order_release);
+
+            uint32_t events = changed ? util::kUpdateTouch : 0u;
+            if (x >= 0 && start_x < 0) {
+                start_x = x;
+                start_y = y;
+            } else if (x < 0 && start_x >= 0) {
+                // 離す直前に検出した位置と開始位置の差で判定する
+                events |= SwipeEvent(prev_x - start_x, prev_y - start_y);
+                start_x = start_y = -1;
+            }
+
+            if (events != 0 && notifier_) {
+                notifier_->Notify(events);
             }
             
             std::this_thread::sleep_for(POLL_INTERVAL);
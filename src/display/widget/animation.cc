@@ -0,0 +1,61 @@
+#include "display/widget/animation.h"
+
+#include <algorithm>
+
+namespace ui {
+
+Tween::Tween(std::chrono::milliseconds duration, Easing easing)
+    : duration_(std::max(duration, std::chrono::milliseconds(0))), easing_(easing) {}
+
+void Tween::SetTarget(double target, Clock::time_point now) {
+    if (target == to_) return;
+    from_ = Value(now);
+    to_ = target;
+    start_ = now;
+    end_ = now + duration_;
+}
+
+void Tween::Jump(double value) {
+    from_ = to_ = value;
+    start_ = end_ = Clock::time_point{};
+}
+
+double Tween::Value(Clock::time_point now) const {
+    if (now >= end_) return to_;
+    if (now <= start_) return from_;
+    const double t = std::chrono::duration<double>(now - start_).count() /
+                     std::chrono::duration<double>(end_ - start_).count();
+    double k = t;
+    if (easing_ == Easing::kEaseOut) {
+        const double u = 1.0 - t;
+        k = 1.0 - u * u * u;
+    }
+    return from_ + (to_ - from_) * k;
+}
+
+AnimationScheduler::AnimationScheduler(int fps)
+    : period_(std::chrono::duration_cast<Clock::duration>(std::chrono::seconds(1)) /
+              std::max(1, fps)) {}
+
+void AnimationScheduler::FrameDone(Clock::time_point start, Clock::time_point end) {
+    const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+    ++stats_.frames;
+    stats_.last_frame_time = elapsed;
+    stats_.max_frame_time = std::max(stats_.max_frame_time, elapsed);
+    stats_.total_frame_time += elapsed;
+    if (end - start > period_) ++stats_.over_budget;
+
+    if (!active_) {
+        next_ = start;
+        active_ = true;
+    }
+    next_ += period_;
+    // 既に過ぎた時刻のフレームは描かずに飛ばす
+    if (next_ <= end) {
+        const auto late = (end - next_) / period_ + 1;
+        stats_.dropped += static_cast<uint64_t>(late);
+        next_ += late * period_;
+    }
+}
+
+}  // namespace ui
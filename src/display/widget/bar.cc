@@ -0,0 +1,34 @@
+#include "display/widget/bar.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace ui {
+
+Bar::Bar(const display::Rect& bounds, ValueSource source, double min_value, double max_value,
+         Color565 fg, Color565 bg)
+    : Widget(bounds), source_(std::move(source)), min_(min_value), max_(max_value), fg_(fg),
+      bg_(bg) {}
+
+void Bar::Update() {
+    if (!source_) return;
+    const double v = source_();
+    int px = 0;
+    if (std::isfinite(v) && max_ > min_) {
+        const double t = std::clamp((v - min_) / (max_ - min_), 0.0, 1.0);
+        px = static_cast<int>(std::lround(t * Bounds().w));
+    }
+    if (px != fill_px_) {
+        fill_px_ = px;
+        MarkDirty();
+    }
+}
+
+void Bar::OnRender(RenderContext& ctx) {
+    const display::Rect& b = Bounds();
+    ctx.canvas.FillRect(display::Rect{b.x, b.y, fill_px_, b.h}, fg_.value);
+    ctx.canvas.FillRect(display::Rect{b.x + fill_px_, b.y, b.w - fill_px_, b.h}, bg_.value);
+}
+
+}  // namespace ui
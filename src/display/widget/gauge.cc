@@ -0,0 +1,105 @@
+#include "display/widget/gauge.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace ui {
+
+namespace {
+constexpr float kPi = 3.14159265358979f;
+constexpr float kTickRatio = 0.12f;  // 目盛り線の長さ（円の半径に対する比）
+}  // namespace
+
+Gauge::Gauge(const display::Rect& bounds, ValueSource source, double min_value,
+             double max_value, std::chrono::milliseconds tween, const GaugeStyle& style)
+    : Widget(bounds), source_(std::move(source)), min_(min_value), max_(max_value),
+      style_(style), tween_(tween, Easing::kEaseOut) {
+    const float outer = std::min(bounds.w, bounds.h) * 0.5f;
+    cx_ = bounds.x + bounds.w * 0.5f;
+    cy_ = bounds.y + bounds.h * 0.5f;
+    radius_ = outer - style_.scale_px * 0.5f - 1.0f;
+    needle_len_ = radius_ - style_.scale_px * 0.5f - 4.0f;
+    hub_r_ = style_.needle_px * 1.4f;
+
+    tween_.Jump(min_);
+    angle_ = drawn_angle_ = ValueToAngle(min_);
+    drawn_ = NeedleBounds(angle_);
+}
+
+void Gauge::Update() {
+    if (!source_) return;
+    double v = source_();
+    if (!std::isfinite(v)) v = min_;
+    tween_.SetTarget(std::clamp(v, std::min(min_, max_), std::max(min_, max_)),
+                     std::chrono::steady_clock::now());
+}
+
+bool Gauge::Animate(std::chrono::steady_clock::time_point now) {
+    angle_ = ValueToAngle(tween_.Value(now));
+    const bool done = tween_.Done(now);
+    // 細かすぎる動きは描かない（止まるときは最終位置を必ず描く）
+    if (std::fabs(angle_ - drawn_angle_) >= kMinStepDeg || (done && angle_ != drawn_angle_)) {
+        MarkDirty();
+    }
+    return !done;
+}
+
+void Gauge::Invalidate() {
+    full_redraw_ = true;
+    Widget::Invalidate();
+}
+
+float Gauge::ValueToAngle(double value) const {
+    double t = 0.0;
+    if (max_ != min_) t = std::clamp((value - min_) / (max_ - min_), 0.0, 1.0);
+    return style_.start_deg + style_.sweep_deg * static_cast<float>(t);
+}
+
+display::Rect Gauge::NeedleBounds(float angle_deg) const {
+    const float rad = angle_deg * kPi / 180.0f;
+    const float tip_x = cx_ + std::cos(rad) * needle_len_;
+    const float tip_y = cy_ + std::sin(rad) * needle_len_;
+    const float half = style_.needle_px * 0.5f;
+    const int x0 = static_cast<int>(std::floor(std::min(cx_ - hub_r_, tip_x - half))) - 1;
+    const int y0 = static_cast<int>(std::floor(std::min(cy_ - hub_r_, tip_y - half))) - 1;
+    const int x1 = static_cast<int>(std::ceil(std::max(cx_ + hub_r_, tip_x + half))) + 1;
+    const int y1 = static_cast<int>(std::ceil(std::max(cy_ + hub_r_, tip_y + half))) + 1;
+    return display::Rect{x0, y0, x1 - x0, y1 - y0};
+}
+
+void Gauge::OnRender(RenderContext& ctx) {
+    const display::Rect& b = Bounds();
+    const display::Rect next = NeedleBounds(angle_);
+    // 前回の指針を消し、今回の指針を描く範囲だけを描き直す
+    const display::Rect area =
+        full_redraw_ ? b : display::Rect::Intersect(display::Rect::Union(drawn_, next), b);
+    ctx.ClearBackground(area, style_.bg);
+    ras_.SetClip(area);
+
+    // 目盛り（範囲外の部分はラスタライザが走査しない）
+    ras_.AddArc(cx_, cy_, radius_, style_.start_deg, style_.sweep_deg, style_.scale_px);
+    const float tick_len = radius_ * kTickRatio;
+    const float tick_step = style_.ticks > 1 ? style_.sweep_deg / (style_.ticks - 1) : 0.0f;
+    for (int i = 0; i < style_.ticks; ++i) {
+        const float a = (style_.start_deg + tick_step * i) * kPi / 180.0f;
+        const float c = std::cos(a), s = std::sin(a);
+        ras_.AddLine(cx_ + c * radius_, cy_ + s * radius_, cx_ + c * (radius_ - tick_len),
+                     cy_ + s * (radius_ - tick_len), style_.scale_px);
+    }
+    ras_.Fill(ctx.canvas, style_.scale.value);
+
+    // 指針と軸
+    const float rad = angle_ * kPi / 180.0f;
+    ras_.AddLine(cx_, cy_, cx_ + std::cos(rad) * needle_len_, cy_ + std::sin(rad) * needle_len_,
+                 style_.needle_px);
+    ras_.AddCircle(cx_, cy_, hub_r_);
+    ras_.Fill(ctx.canvas, style_.needle.value);
+    ras_.ResetClip();
+
+    drawn_ = next;
+    drawn_angle_ = angle_;
+    full_redraw_ = false;
+}
+
+}  // namespace ui
@@ -0,0 +1,60 @@
+#include "display/widget/icon.h"
+
+#include <utility>
+
+namespace ui {
+
+Icon::Icon(const display::Rect& bounds, StateSource source, std::vector<const RleIcon*> images,
+           Color565 bg)
+    : Widget(bounds), source_(std::move(source)), images_(std::move(images)), bg_(bg) {}
+
+void Icon::Update() {
+    if (!source_) return;
+    const int s = source_();
+    if (s != state_) {
+        state_ = s;
+        MarkDirty();
+    }
+}
+
+void Icon::Invalidate() {
+    full_redraw_ = true;
+    Widget::Invalidate();
+}
+
+const RleIcon* Icon::ImageFor(int state) const {
+    if (state < 0 || state >= static_cast<int>(images_.size())) return nullptr;
+    return images_[state];
+}
+
+display::Rect Icon::Placement(const RleIcon& icon) const {
+    const display::Rect& b = Bounds();
+    return display::Rect{b.x + (b.w - icon.width) / 2, b.y + (b.h - icon.height) / 2, icon.width,
+                         icon.height};
+}
+
+void Icon::OnRender(RenderContext& ctx) {
+    const display::Rect clip = display::Rect::Intersect(Bounds(), ctx.canvas.Bounds());
+    uint16_t* px = ctx.canvas.Pixels();
+    const int stride = ctx.canvas.Stride();
+    const RleIcon* next = ImageFor(state_);
+
+    if (full_redraw_) {
+        ctx.ClearBackground(Bounds(), bg_);
+    } else if (drawn_) {
+        // 前のアイコンが描いた画素だけを背景に戻す（背景レイヤはキャンバスと同じ並び）
+        const display::Rect r = Placement(*drawn_);
+        const uint16_t* layer = ctx.compositor ? ctx.compositor->Layer().pixels : nullptr;
+        EraseRleIcon(*drawn_, px, stride, r.x, r.y, clip, layer, bg_.value);
+        ctx.canvas.MarkDirty(display::Rect::Intersect(r, clip));
+    }
+    if (next) {
+        const display::Rect r = Placement(*next);
+        BlitRleIcon<driver::PixelOrder::kHost>(*next, px, stride, r.x, r.y, clip);
+        ctx.canvas.MarkDirty(display::Rect::Intersect(r, clip));
+    }
+    drawn_ = next;
+    full_redraw_ = false;
+}
+
+}  // namespace ui
@@ -0,0 +1,39 @@
+#include "display/widget/label.h"
+
+#include <utility>
+
+namespace ui {
+
+Label::Label(const display::Rect& bounds, Source source, const TextStyle& style)
+    : Widget(bounds), source_(std::move(source)), style_(style) {}
+
+Label::Label(const display::Rect& bounds, const std::string& text, const TextStyle& style)
+    : Widget(bounds), style_(style), text_(text) {}
+
+void Label::Update() {
+    if (source_) SetText(source_());
+}
+
+void Label::SetText(const std::string& text) {
+    if (text == text_) return;
+    text_ = text;
+    MarkDirty();
+}
+
+void Label::PrepareText(RenderContext& ctx) const {
+    ctx.text.SetBackgroundLayer(ctx.compositor ? ctx.compositor->Layer()
+                                               : display::SurfaceView{});
+    ctx.text.SetFontSizePx(style_.font_px);
+    ctx.text.SetColors(style_.fg, style_.bg);
+    ctx.text.SetWrapWidthPx(0);
+    ctx.text.SetTabularFigures(style_.tabular);
+}
+
+void Label::OnRender(RenderContext& ctx) {
+    const display::Rect& b = Bounds();
+    // 領域全体を背景レイヤ（なければ背景色）から組み立て直すため、事前の消去は不要
+    PrepareText(ctx);
+    ctx.text.DrawLabel(b.x, b.y, b.w, b.h, text_, style_.center);
+}
+
+}  // namespace ui
@@ -0,0 +1,97 @@
+#include "display/widget/numeric_field.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <utility>
+
+namespace ui {
+
+namespace {
+
+// 数値は常に等幅数字で表示する
+TextStyle TabularStyle(TextStyle style) {
+    style.tabular = true;
+    return style;
+}
+
+}  // namespace
+
+NumericField::NumericField(const display::Rect& bounds, ValueSource source, int decimals,
+                           const TextStyle& style, const std::string& placeholder)
+    : Label(bounds, std::string(), TabularStyle(style)),
+      value_source_(std::move(source)),
+      decimals_(decimals),
+      placeholder_(placeholder) {}
+
+void NumericField::Update() {
+    if (value_source_) SetText(Format(value_source_()));
+}
+
+void NumericField::Invalidate() {
+    cells_.clear();
+    Label::Invalidate();
+}
+
+void NumericField::OnRender(RenderContext& ctx) {
+    const display::Rect& b = Bounds();
+    PrepareText(ctx);
+    const display::SurfaceView layer =
+        ctx.compositor ? ctx.compositor->Layer() : display::SurfaceView{};
+
+    // 今回の配置から文字ごとの区画を求める（区画は次の文字のペン位置まで）
+    ctx.text.PlaceLabel(b.x, b.y, b.w, b.h, Text(), Style().center, placement_);
+    const auto& glyphs = placement_.glyphs;
+    next_.clear();
+    bool single_line = true;
+    for (size_t i = 0; i < glyphs.size(); ++i) {
+        const int x1 = i + 1 < glyphs.size()
+                           ? glyphs[i + 1].x
+                           : placement_.pen_x + placement_.metrics.width_px;
+        if (x1 < glyphs[i].x) single_line = false;
+        next_.push_back(Cell{glyphs[i].codepoint, glyphs[i].x, x1});
+    }
+
+    bool same_cells = single_line && !cells_.empty() && cells_.size() == next_.size() &&
+                      pen_y_ == placement_.pen_y && layer_pixels_ == layer.pixels &&
+                      layer_version_ == layer.version;
+    for (size_t i = 0; same_cells && i < next_.size(); ++i) {
+        same_cells = cells_[i].x0 == next_[i].x0 && cells_[i].x1 == next_[i].x1;
+    }
+
+    if (!same_cells) {
+        ctx.text.DrawLabel(b.x, b.y, b.w, b.h, Text(), Style().center);
+    } else {
+        // 文字が変わった区画を、隣接するものはまとめて描き直す
+        for (size_t i = 0; i < next_.size();) {
+            if (cells_[i].codepoint == next_[i].codepoint) {
+                ++i;
+                continue;
+            }
+            size_t end = i + 1;
+            while (end < next_.size() && cells_[end].codepoint != next_[end].codepoint) ++end;
+            const int x0 = std::max(b.x, next_[i].x0);
+            const int x1 = std::min(b.x + b.w, next_[end - 1].x1);
+            if (x0 < x1) {
+                ctx.text.DrawLabelPart(x0, b.y, x1 - x0, b.h, placement_.pen_x,
+                                       placement_.pen_y, Text());
+            }
+            i = end;
+        }
+    }
+
+    cells_.swap(next_);
+    if (!single_line) cells_.clear();
+    pen_y_ = placement_.pen_y;
+    layer_pixels_ = layer.pixels;
+    layer_version_ = layer.version;
+}
+
+std::string NumericField::Format(double value) const {
+    if (!std::isfinite(value)) return placeholder_;
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "%.*f", decimals_, value);
+    return std::string(buf);
+}
+
+}  // namespace ui
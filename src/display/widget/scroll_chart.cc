@@ -0,0 +1,115 @@
+#include "display/widget/scroll_chart.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include "display/flush_manager.h"
+
+namespace ui {
+
+ScrollChart::ScrollChart(const display::Rect& bounds, ValueSource source, double min_value,
+                         double max_value, std::chrono::milliseconds interval,
+                         const ChartStyle& style)
+    : Widget(bounds),
+      source_(std::move(source)),
+      min_(min_value),
+      max_(max_value),
+      interval_(interval),
+      style_(style),
+      samples_(static_cast<size_t>(std::max(0, style.horizontal ? bounds.w : bounds.h)), kGap),
+      length_(std::max(0, style.horizontal ? bounds.h : bounds.w)),
+      line_(static_cast<size_t>(length_)) {}
+
+void ScrollChart::Update() {
+    if (!source_ || samples_.empty()) return;
+    const Clock::time_point now = Clock::now();
+    if (count_ > 0 && now - last_sample_ < interval_) return;
+    last_sample_ = now;
+    Push(source_());
+}
+
+void ScrollChart::Invalidate() {
+    full_redraw_ = true;
+    Widget::Invalidate();
+}
+
+void ScrollChart::Push(double value) {
+    int16_t px = kGap;
+    if (std::isfinite(value) && max_ > min_) {
+        double t = std::clamp((value - min_) / (max_ - min_), 0.0, 1.0);
+        if (style_.horizontal) t = 1.0 - t;  // 上が大きい値
+        px = static_cast<int16_t>(std::lround(t * (length_ - 1)));
+    }
+    const int cap = Capacity();
+    samples_[head_] = px;
+    head_ = (head_ + 1) % cap;
+    count_ = std::min(count_ + 1, cap);
+    unrendered_ = std::min(unrendered_ + 1, cap);
+    MarkDirty();
+}
+
+void ScrollChart::DrawSample(display::Framebuffer& canvas, int index, int pos) {
+    const display::Rect& b = Bounds();
+    std::fill(line_.begin(), line_.end(), style_.bg.value);
+
+    // 1つ前のサンプルとの間を線分でつなぐ（最も古いサンプルと欠測はつながない）
+    const int cap = Capacity();
+    const int cur = samples_[index];
+    const int oldest = (head_ - count_ + cap) % cap;
+    const int prev = index == oldest ? kGap : samples_[(index - 1 + cap) % cap];
+    if (cur != kGap) {
+        const int lo = (prev == kGap ? cur : std::min(cur, prev)) - style_.line_px / 2;
+        const int hi = (prev == kGap ? cur : std::max(cur, prev)) + (style_.line_px - 1) / 2;
+        const int p0 = std::max(0, lo), p1 = std::min(length_ - 1, hi);
+        if (p0 <= p1) std::fill(line_.begin() + p0, line_.begin() + p1 + 1, style_.fg.value);
+    }
+    if (style_.horizontal) {
+        canvas.DrawRGB565Rect(b.x + pos, b.y, 1, length_, line_.data(), 1,
+                              driver::PixelOrder::kHost);
+    } else {
+        canvas.DrawRGB565Rect(b.x, b.y + pos, length_, 1, line_.data(), length_,
+                              driver::PixelOrder::kHost);
+    }
+}
+
+void ScrollChart::OnRender(RenderContext& ctx) {
+    const display::Rect& b = Bounds();
+    const int cap = Capacity();
+    if (cap == 0) return;
+
+    // スクロールの方向が時間軸と異なる場合や、直交方向に画面全体を占めない場合
+    // （スクロールで他の表示が動く）はハードウェアスクロールを使わない
+    bool hardware = ctx.flush && ctx.flush->SupportsHardwareScroll();
+    if (hardware && style_.horizontal) {
+        hardware = ctx.flush->GetScrollAxis() == driver::ScrollAxis::kColumns && b.y == 0 &&
+                   b.h == ctx.canvas.GetHeight();
+    } else if (hardware) {
+        hardware = ctx.flush->GetScrollAxis() == driver::ScrollAxis::kRows && b.x == 0 &&
+                   b.w == ctx.canvas.GetWidth();
+    }
+
+    if (!hardware) {
+        // 表示順（先頭が最も古い）に全ラインを描き直す
+        for (int k = 0; k < cap; ++k) DrawSample(ctx.canvas, (head_ + k) % cap, k);
+    } else if (full_redraw_) {
+        // メモリ上の並び（添字 = ライン）で全ラインを描く
+        for (int i = 0; i < cap; ++i) DrawSample(ctx.canvas, i, i);
+    } else {
+        // 新しいサンプルのラインだけを描く
+        for (int k = unrendered_; k > 0; --k) {
+            const int i = (head_ - k + cap) % cap;
+            DrawSample(ctx.canvas, i, i);
+        }
+    }
+    // 最も古いサンプルのラインを領域の先頭に表示する（最新のサンプルが末尾に来る）
+    if (hardware) {
+        const int top = style_.horizontal ? b.x : b.y;
+        ctx.flush->SetScroll(top, cap, top + head_);
+    }
+
+    unrendered_ = 0;
+    full_redraw_ = false;
+}
+
+}  // namespace ui
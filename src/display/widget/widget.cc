@@ -0,0 +1,40 @@
+#include "display/widget/widget.h"
+
+namespace ui {
+
+bool Widget::Render(RenderContext& ctx) {
+    if (!dirty_) return false;
+    OnRender(ctx);
+    dirty_ = false;
+    return true;
+}
+
+void WidgetTree::Update() {
+    for (auto& w : widgets_) {
+        w->Update();
+    }
+}
+
+bool WidgetTree::Animate(std::chrono::steady_clock::time_point now) {
+    bool animating = false;
+    for (auto& w : widgets_) {
+        if (w->Animate(now)) animating = true;
+    }
+    return animating;
+}
+
+int WidgetTree::Render(RenderContext& ctx) {
+    int n = 0;
+    for (auto& w : widgets_) {
+        if (w->Render(ctx)) ++n;
+    }
+    return n;
+}
+
+void WidgetTree::InvalidateAll() {
+    for (auto& w : widgets_) {
+        w->Invalidate();
+    }
+}
+
+}  // namespace ui
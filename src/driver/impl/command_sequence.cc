@@ -0,0 +1,34 @@
+#include "driver/impl/command_sequence.h"
+
+namespace driver {
+
+CommandSequence::CommandSequence(size_t reserve_bytes) {
+    bytes_.reserve(reserve_bytes);
+    runs_.reserve(reserve_bytes);
+}
+
+CommandSequence& CommandSequence::Add(uint8_t cmd, std::initializer_list<uint8_t> params) {
+    return Add(cmd, params.begin(), params.size());
+}
+
+CommandSequence& CommandSequence::Add(uint8_t cmd, const uint8_t* params, size_t n) {
+    Append(false, &cmd, 1);
+    if (n > 0) Append(true, params, n);
+    return *this;
+}
+
+void CommandSequence::Clear() {
+    bytes_.clear();
+    runs_.clear();
+}
+
+void CommandSequence::Append(bool data, const uint8_t* p, size_t n) {
+    // 直前のランとDCレベルが同じなら結合する
+    if (runs_.empty() || runs_.back().data != data) {
+        runs_.push_back(Run{data, bytes_.size(), 0});
+    }
+    bytes_.insert(bytes_.end(), p, p + n);
+    runs_.back().len += n;
+}
+
+}  // namespace driver
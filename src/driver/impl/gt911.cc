@@ -4,8 +4,9 @@
 
 namespace driver {
 
-GT911::GT911(hal::II2c* i2c, hal::IGpio* rst, hal::IGpio* int_pin, uint8_t i2c_addr)
-    : i2c_(i2c), rst_(rst), int_pin_(int_pin), i2c_addr_(i2c_addr) {
+GT911::GT911(hal::II2c* i2c, hal::IGpio* rst, hal::IGpio* int_pin, uint8_t i2c_addr,
+             Orientation orientation)
+    : i2c_(i2c), rst_(rst), int_pin_(int_pin), i2c_addr_(i2c_addr), orientation_(orientation) {
     if (!i2c_ || !rst_ || !int_pin_) {
         throw std::invalid_argument("GT911: null pointer provided");
     }
@@ -101,8 +102,26 @@ void GT911::ReadTouchData(TouchPoint& point) {
     if (y < 0) y = 0;
     else if (y >= kCoordinateYMax) y = kCoordinateYMax - 1;
 
-    point.x = x;
-    point.y = y;
+    // 縦長の座標をディスプレイの向き（MADCTL の行列交換・反転）に合わせて回転する
+    switch (orientation_) {
+    case Orientation::kLandscape:
+        point.x = y;
+        point.y = kCoordinateXMax - 1 - x;
+        break;
+    case Orientation::kPortraitFlipped:
+        point.x = kCoordinateXMax - 1 - x;
+        point.y = kCoordinateYMax - 1 - y;
+        break;
+    case Orientation::kLandscapeFlipped:
+        point.x = kCoordinateYMax - 1 - y;
+        point.y = x;
+        break;
+    case Orientation::kPortrait:
+    default:
+        point.x = x;
+        point.y = y;
+        break;
+    }
     point.touched = true;
 
     ClearStatus();
@@ -1,21 +1,43 @@
 #include "driver/impl/st7796.h"
-#include "third_party/stb_image.h"
+#include "driver/impl/pixel_format.h"
+#include "util/byte_swap.h"
+#include "util/image_loader.h"
 #include <algorithm>
-#include <array>
 #include <stdexcept>
 #include <vector>
 #include <unistd.h>
-#include <cmath>
-#include <cstdio>
+#include <cstring>
 
 namespace driver {
 
-ST7796::ST7796(hal::ISpi* spi, hal::IGpio* dc, hal::IGpio* rst, hal::IGpio* bl)
-    : spi_(spi), dc_(dc), rst_(rst), bl_(bl) {
+namespace {
+
+// MADCTL (0x36) のビット
+constexpr uint8_t kMadctlMY = 0x80;   // 行アドレス反転
+constexpr uint8_t kMadctlMX = 0x40;   // 列アドレス反転
+constexpr uint8_t kMadctlMV = 0x20;   // 行列交換
+constexpr uint8_t kMadctlBGR = 0x08;  // BGR 順
+
+}  // namespace
+
+ST7796::ST7796(hal::ISpi* spi, hal::IGpio* dc, hal::IGpio* rst, hal::IGpio* bl,
+               Orientation orientation, PixelFormat format, hal::IGpio* te)
+    : spi_(spi), dc_(dc), rst_(rst), bl_(bl), te_(te), orientation_(orientation),
+      pixel_format_(format) {
     if (!spi_ || !dc_ || !rst_ || !bl_) {
         throw std::invalid_argument("ST7796: null pointer provided");
     }
+
+    // 1回の書き込みをspidevのbufsizいっぱいまで使う（ピクセル境界に揃えて偶数バイト）
+    chunk_bytes_ = std::max<size_t>(2, spi_->MaxTransferSize() & ~static_cast<size_t>(1));
+    tx_buf_.resize(chunk_bytes_);
+    // どの形式でも画素の区切り（2/3/6バイト）が揃うよう、6の倍数にしておく
+    fill_buf_.resize(std::max<size_t>(6, chunk_bytes_ / 6 * 6));
     
+    UpdateLogicalSize();
+    // TE は垂直ブランキングの開始で立ち上がる
+    if (te_) te_->RequestRisingEdge();
+
     // 初期化シーケンス
     Reset();
     Init();
@@ -23,111 +45,225 @@ ST7796::ST7796(hal::ISpi* spi, hal::IGpio* dc, hal::IGpio* rst, hal::IGpio* bl)
 }
 
 void ST7796::Clear(uint16_t rgb565) {
-    SetAddressWindow(0, 0, kWidth - 1, kHeight - 1);
-    DataMode(true);
-    std::vector<uint8_t> line(kWidth * 2);
-    for (int y = 0; y < kHeight; ++y) {
-        for (int x = 0; x < kWidth; ++x) {
-            line[2 * x + 0] = static_cast<uint8_t>((rgb565 >> 8) & 0xFF);
-            line[2 * x + 1] = static_cast<uint8_t>(rgb565 & 0xFF);
-        }
-        SendChunked(line.data(), line.size());
-    }
+    SetAddressWindow(0, 0, width_ - 1, height_ - 1);
+    SendFill(rgb565, static_cast<size_t>(width_) * height_);
 }
 
 void ST7796::DrawFilledRect(int x0, int y0, int x1, int y1, uint16_t rgb565) {
     if (x0 > x1) std::swap(x0, x1);
     if (y0 > y1) std::swap(y0, y1);
     x0 = std::max(0, x0); y0 = std::max(0, y0);
-    x1 = std::min(kWidth - 1, x1);
-    y1 = std::min(kHeight - 1, y1);
+    x1 = std::min(width_ - 1, x1);
+    y1 = std::min(height_ - 1, y1);
     if (x0 > x1 || y0 > y1) return;
 
     SetAddressWindow(x0, y0, x1, y1);
-    DataMode(true);
-
-    const int w = (x1 - x0 + 1);
-    std::vector<uint8_t> line(w * 2);
-    for (int i = 0; i < w; ++i) {
-        line[2 * i + 0] = static_cast<uint8_t>((rgb565 >> 8) & 0xFF);
-        line[2 * i + 1] = static_cast<uint8_t>(rgb565 & 0xFF);
-    }
-    for (int y = y0; y <= y1; ++y) {
-        SendChunked(line.data(), line.size());
-    }
+    SendFill(rgb565, static_cast<size_t>(x1 - x0 + 1) * (y1 - y0 + 1));
 }
 
 void ST7796::BlitRGB565(const uint8_t* buf, size_t len) {
-    const size_t expected = static_cast<size_t>(kWidth) * kHeight * 2;
+    const size_t expected = static_cast<size_t>(width_) * height_ * 2;
     if (len != expected) throw std::runtime_error("BlitRGB565: size mismatch");
-    SetAddressWindow(0, 0, kWidth - 1, kHeight - 1);
+    if (pixel_format_ != PixelFormat::kRGB565) {
+        DrawRGB565Rect(0, 0, width_, height_, reinterpret_cast<const uint16_t*>(buf), width_,
+                       PixelOrder::kPanel);
+        return;
+    }
+    SetAddressWindow(0, 0, width_ - 1, height_ - 1);
     DataMode(true);
     SendChunked(buf, len);
 }
 
 void ST7796::DrawRGB565Line(int x, int y, const uint16_t* rgb565, int len) {
-    if (len <= 0) return;
-    SetAddressWindow(x, y, x + len - 1, y);
+    DrawRGB565Rect(x, y, len, 1, rgb565, len, PixelOrder::kHost);
+}
+
+void ST7796::DrawRGB565Rect(int x, int y, int w, int h, const uint16_t* px, int stride_px,
+                            PixelOrder order) {
+    switch (pixel_format_) {
+    case PixelFormat::kRGB444:
+        DrawRectAs<PixelFormat::kRGB444>(x, y, w, h, px, stride_px, order);
+        break;
+    case PixelFormat::kRGB666:
+        DrawRectAs<PixelFormat::kRGB666>(x, y, w, h, px, stride_px, order);
+        break;
+    case PixelFormat::kRGB565:
+    default:
+        DrawRectAs<PixelFormat::kRGB565>(x, y, w, h, px, stride_px, order);
+        break;
+    }
+}
+
+template <PixelFormat F>
+void ST7796::DrawRectAs(int x, int y, int w, int h, const uint16_t* px, int stride_px,
+                        PixelOrder order) {
+    using T = PixelFormatTraits<F>;
+    if (w <= 0 || h <= 0) return;
+    SetAddressWindow(x, y, x + w - 1, y + h - 1);
     DataMode(true);
 
-    std::vector<uint8_t> bytes(static_cast<size_t>(len) * 2);
-    for (int i = 0; i < len; ++i) {
-        uint16_t p = rgb565[i];
-        bytes[2 * i + 0] = static_cast<uint8_t>((p >> 8) & 0xFF);
-        bytes[2 * i + 1] = static_cast<uint8_t>(p & 0xFF);
+    // パネル順かつ行間の隙間がなければ、そのまま大きな単位で送る
+    if (F == PixelFormat::kRGB565 && order == PixelOrder::kPanel && stride_px == w) {
+        SendChunked(reinterpret_cast<const uint8_t*>(px), static_cast<size_t>(w) * h * 2);
+        return;
+    }
+
+    // 1回の転送に収まる画素数（グループ単位に揃える）
+    const size_t cap_px = chunk_bytes_ / T::kGroupBytes * T::kGroupPixels;
+    uint8_t* tx = tx_buf_.data();
+    size_t fill = 0;
+    if constexpr (T::kGroupPixels == 1) {
+        // 行を転送形式へ詰めながら転送バッファに溜める（ホスト順ならここでバイト入れ替え）
+        for (int row = 0; row < h; ++row) {
+            const uint16_t* src = px + static_cast<size_t>(row) * stride_px;
+            size_t remain = static_cast<size_t>(w);
+            while (remain > 0) {
+                const size_t n = std::min(remain, cap_px - fill);
+                uint8_t* dst = tx + fill * T::kGroupBytes;
+                if (order == PixelOrder::kPanel) {
+                    PackPixels<F, PixelOrder::kPanel>(src, n, dst);
+                } else {
+                    PackPixels<F, PixelOrder::kHost>(src, n, dst);
+                }
+                src += n;
+                remain -= n;
+                fill += n;
+                if (fill == cap_px) {
+                    spi_->WriteBytes(tx, PixelBytes<F>(fill));
+                    fill = 0;
+                }
+            }
+        }
+        if (fill > 0) spi_->WriteBytes(tx, PixelBytes<F>(fill));
+    } else {
+        // グループが行をまたぐため、いったんホスト順で溜めてからまとめて詰める
+        stage_.resize(cap_px);
+        for (int row = 0; row < h; ++row) {
+            const uint16_t* src = px + static_cast<size_t>(row) * stride_px;
+            size_t remain = static_cast<size_t>(w);
+            while (remain > 0) {
+                const size_t n = std::min(remain, cap_px - fill);
+                if (order == PixelOrder::kPanel) {
+                    util::SwapBytes16(src, stage_.data() + fill, n);
+                } else {
+                    std::memcpy(stage_.data() + fill, src, n * 2);
+                }
+                src += n;
+                remain -= n;
+                fill += n;
+                if (fill == cap_px) {
+                    spi_->WriteBytes(tx, PackPixels<F, PixelOrder::kHost>(stage_.data(), fill, tx));
+                    fill = 0;
+                }
+            }
+        }
+        if (fill > 0) {
+            spi_->WriteBytes(tx, PackPixels<F, PixelOrder::kHost>(stage_.data(), fill, tx));
+        }
     }
-    SendChunked(bytes.data(), bytes.size());
 }
 
 bool ST7796::DrawBackgroundImage(const std::string& path) {
-    int w, h, ch;
-    unsigned char* img = stbi_load(path.c_str(), &w, &h, &ch, 0);
-    if (!img) {
-        std::fprintf(stderr, "Failed to load background: %s\n", path.c_str());
+    // 1フレーム分を組み立て、1回のウィンドウ設定で送る
+    std::vector<uint16_t> frame;
+    if (!util::LoadImageRGB565(path, width_, height_, frame)) {
         return false;
     }
-    if (ch < 3) {
-        stbi_image_free(img);
-        return false;
+    DrawRGB565Rect(0, 0, width_, height_, frame.data(), width_, PixelOrder::kHost);
+    return true;
+}
+
+bool ST7796::WaitForVBlank(std::chrono::microseconds timeout) {
+    return te_ && te_->WaitForEdge(timeout);
+}
+
+uint8_t ST7796::Madctl(Orientation orientation) {
+    switch (orientation) {
+    case Orientation::kLandscape:
+        return kMadctlMV | kMadctlBGR;
+    case Orientation::kPortraitFlipped:
+        return kMadctlMY | kMadctlBGR;
+    case Orientation::kLandscapeFlipped:
+        return kMadctlMY | kMadctlMX | kMadctlMV | kMadctlBGR;
+    case Orientation::kPortrait:
+    default:
+        return kMadctlMX | kMadctlBGR;
     }
+}
 
-    std::vector<uint16_t> line(kWidth);
+void ST7796::SetOrientation(Orientation orientation) {
+    orientation_ = orientation;
+    UpdateLogicalSize();
+    Send(CommandSequence().Add(0x36, {Madctl(orientation_)}));
+    // アドレスの解釈が変わるため、ウィンドウとスクロールは送り直す
+    win_xs_ = win_xe_ = win_ys_ = win_ye_ = -1;
+    scroll_top_ = scroll_height_ = scroll_start_ = -1;
+}
 
-    const double scale = std::max(double(kWidth) / w, double(kHeight) / h);
-    const double sw = kWidth / scale;
-    const double sh = kHeight / scale;
-    const double sx0 = (w - sw) * 0.5;
-    const double sy0 = (h - sh) * 0.5;
+void ST7796::UpdateLogicalSize() {
+    const bool exchanged = (Madctl(orientation_) & kMadctlMV) != 0;
+    width_ = exchanged ? kNativeHeight : kNativeWidth;
+    height_ = exchanged ? kNativeWidth : kNativeHeight;
+}
 
-    for (int y = 0; y < kHeight; ++y) {
-        double fy = sy0 + (y + 0.5) / scale;
-        int sy = std::clamp(static_cast<int>(std::floor(fy)), 0, h - 1);
-        for (int x = 0; x < kWidth; ++x) {
-            double fx = sx0 + (x + 0.5) / scale;
-            int sx = std::clamp(static_cast<int>(std::floor(fx)), 0, w - 1);
-            const unsigned char* p = img + (sy * w + sx) * ch;
-            uint16_t c = ((p[0] & 0xF8) << 8) | ((p[1] & 0xFC) << 3) | (p[2] >> 3);
-            line[x] = c;
-        }
-        DrawRGB565Line(0, y, line.data(), kWidth);
-    }
+ScrollAxis ST7796::GetScrollAxis() const {
+    // スクロールは常にメモリの行（ゲート方向）単位。行列交換時は論理的な列になる
+    return (Madctl(orientation_) & kMadctlMV) ? ScrollAxis::kColumns : ScrollAxis::kRows;
+}
 
-    stbi_image_free(img);
-    return true;
+void ST7796::SetScrollArea(int top, int height) {
+    top = std::max(0, std::min(top, kNativeHeight));
+    height = std::max(0, std::min(height, kNativeHeight - top));
+    if (top == scroll_top_ && height == scroll_height_) return;
+    // 行アドレス反転時は、論理ラインとメモリ行の並びが逆になる
+    const int bottom = kNativeHeight - top - height;
+    const bool mirrored = (Madctl(orientation_) & kMadctlMY) != 0;
+    const int tfa = mirrored ? bottom : top;
+    const int bfa = mirrored ? top : bottom;
+    // VSCRDEF (0x33): 上端固定領域・スクロール領域・下端固定領域の行数（合計が全行数）
+    scroll_seq_.Clear();
+    scroll_seq_.Add(0x33, {static_cast<uint8_t>((tfa >> 8) & 0xFF),
+                           static_cast<uint8_t>(tfa & 0xFF),
+                           static_cast<uint8_t>((height >> 8) & 0xFF),
+                           static_cast<uint8_t>(height & 0xFF),
+                           static_cast<uint8_t>((bfa >> 8) & 0xFF),
+                           static_cast<uint8_t>(bfa & 0xFF)});
+    Send(scroll_seq_);
+    scroll_top_ = top;
+    scroll_height_ = height;
+    scroll_start_ = -1;  // 領域を変えたら開始行も送り直す
 }
 
-void ST7796::DataMode(bool data) {
-    dc_->Set(data ? 1 : 0);
+void ST7796::SetScrollStart(int line) {
+    if (line == scroll_start_ || scroll_height_ <= 0) return;
+    // 反転時は表示がメモリ行の逆順に流れるため、開始位置も逆向きに数える
+    int vsp = line;
+    if (Madctl(orientation_) & kMadctlMY) {
+        const int tfa = kNativeHeight - scroll_top_ - scroll_height_;
+        const int offset = ((scroll_top_ - line) % scroll_height_ + scroll_height_) %
+                           scroll_height_;
+        vsp = tfa + offset;
+    }
+    // VSCSAD (0x37): スクロール領域の先頭に表示するメモリ行
+    scroll_seq_.Clear();
+    scroll_seq_.Add(0x37, {static_cast<uint8_t>((vsp >> 8) & 0xFF),
+                           static_cast<uint8_t>(vsp & 0xFF)});
+    Send(scroll_seq_);
+    scroll_start_ = line;
 }
 
-void ST7796::Cmd(uint8_t c) {
-    DataMode(false);
-    spi_->WriteBytes(&c, 1);
+void ST7796::DataMode(bool data) {
+    const int level = data ? 1 : 0;
+    if (dc_level_ == level) return;
+    dc_->Set(level);
+    dc_level_ = level;
 }
 
-void ST7796::Dat(uint8_t d) {
-    DataMode(true);
-    spi_->WriteBytes(&d, 1);
+void ST7796::Send(const CommandSequence& seq) {
+    for (const CommandSequence::Run& run : seq.runs()) {
+        DataMode(run.data);
+        spi_->WriteBytes(seq.bytes() + run.offset, run.len);
+    }
 }
 
 void ST7796::Reset() {
@@ -137,77 +273,139 @@ void ST7796::Reset() {
 }
 
 void ST7796::SetAddressWindow(int xs, int ys, int xe, int ye) {
-    // CASET (0x2A): X
-    Cmd(0x2A);
-    Dat(static_cast<uint8_t>((xs >> 8) & 0xFF));
-    Dat(static_cast<uint8_t>(xs & 0xFF));
-    Dat(static_cast<uint8_t>((xe >> 8) & 0xFF));
-    Dat(static_cast<uint8_t>(xe & 0xFF));
+    window_seq_.Clear();
+    // CASET (0x2A): X　前回と同じ範囲なら省略する
+    if (xs != win_xs_ || xe != win_xe_) {
+        window_seq_.Add(0x2A, {static_cast<uint8_t>((xs >> 8) & 0xFF),
+                               static_cast<uint8_t>(xs & 0xFF),
+                               static_cast<uint8_t>((xe >> 8) & 0xFF),
+                               static_cast<uint8_t>(xe & 0xFF)});
+        win_xs_ = xs;
+        win_xe_ = xe;
+    }
     // RASET (0x2B): Y
-    Cmd(0x2B);
-    Dat(static_cast<uint8_t>((ys >> 8) & 0xFF));
-    Dat(static_cast<uint8_t>(ys & 0xFF));
-    Dat(static_cast<uint8_t>((ye >> 8) & 0xFF));
-    Dat(static_cast<uint8_t>(ye & 0xFF));
-    // RAMWR
-    Cmd(0x2C);
+    if (ys != win_ys_ || ye != win_ye_) {
+        window_seq_.Add(0x2B, {static_cast<uint8_t>((ys >> 8) & 0xFF),
+                               static_cast<uint8_t>(ys & 0xFF),
+                               static_cast<uint8_t>((ye >> 8) & 0xFF),
+                               static_cast<uint8_t>(ye & 0xFF)});
+        win_ys_ = ys;
+        win_ye_ = ye;
+    }
+    // RAMWR（書き込み位置をウィンドウ先頭に戻すため毎回送る）
+    window_seq_.Add(0x2C);
+    Send(window_seq_);
 }
 
 void ST7796::SendChunked(const uint8_t* data, size_t len) {
-    const size_t CHUNK = 4096;
     size_t off = 0;
     while (off < len) {
-        const size_t n = std::min(CHUNK, len - off);
+        const size_t n = std::min(chunk_bytes_, len - off);
         spi_->WriteBytes(data + off, n);
         off += n;
     }
 }
 
+void ST7796::SendFill(uint16_t rgb565, size_t pixels) {
+    switch (pixel_format_) {
+    case PixelFormat::kRGB444:
+        SendFillAs<PixelFormat::kRGB444>(rgb565, pixels);
+        break;
+    case PixelFormat::kRGB666:
+        SendFillAs<PixelFormat::kRGB666>(rgb565, pixels);
+        break;
+    case PixelFormat::kRGB565:
+    default:
+        SendFillAs<PixelFormat::kRGB565>(rgb565, pixels);
+        break;
+    }
+}
+
+template <PixelFormat F>
+void ST7796::SendFillAs(uint16_t rgb565, size_t pixels) {
+    // 同じ色が続く限り展開済みのパターンを使い回す
+    // （fill_buf_ はグループの倍数なので、どこで区切っても画素の境界が揃う）
+    if (fill_color_ != rgb565) {
+        FillPixels<F>(fill_buf_.data(), rgb565,
+                      fill_buf_.size() / PixelFormatTraits<F>::kGroupBytes *
+                          PixelFormatTraits<F>::kGroupPixels);
+        fill_color_ = rgb565;
+    }
+    DataMode(true);
+    size_t remain = PixelBytes<F>(pixels);
+    while (remain > 0) {
+        const size_t n = std::min(fill_buf_.size(), remain);
+        spi_->WriteBytes(fill_buf_.data(), n);
+        remain -= n;
+    }
+}
+
+uint8_t ST7796::Colmod(PixelFormat format) {
+    switch (format) {
+    case PixelFormat::kRGB444:
+        return PixelFormatTraits<PixelFormat::kRGB444>::kColmod;
+    case PixelFormat::kRGB666:
+        return PixelFormatTraits<PixelFormat::kRGB666>::kColmod;
+    case PixelFormat::kRGB565:
+    default:
+        return PixelFormatTraits<PixelFormat::kRGB565>::kColmod;
+    }
+}
+
+bool ST7796::SetPixelFormat(PixelFormat format) {
+    if (format == pixel_format_) return true;
+    pixel_format_ = format;
+    fill_color_ = -1;  // 塗りつぶしパターンは形式ごとに異なる
+    Send(CommandSequence().Add(0x3A, {Colmod(pixel_format_)}));
+    return true;
+}
+
 void ST7796::Init() {
+    // ウィンドウキャッシュを無効化（リセット後のコントローラ状態は不明）
+    win_xs_ = win_xe_ = win_ys_ = win_ye_ = -1;
+    scroll_top_ = scroll_height_ = scroll_start_ = -1;
+
     // スリープ解除
-    Cmd(0x11);
+    Send(CommandSequence().Add(0x11));
     usleep(120000);
 
-    // メモリアクセス制御 (MADCTL)
-    Cmd(0x36);
-    Dat(0x48);
+    CommandSequence seq(128);
+    // メモリアクセス制御 (MADCTL)：画面の向きはここで決まり、描画時の変換は不要
+    seq.Add(0x36, {Madctl(orientation_)});
 
-    // ピクセルフォーマット（16bpp = RGB565）
-    Cmd(0x3A);
-    Dat(0x55);
+    // ピクセルフォーマット（COLMOD。RGB565 / RGB444 / RGB666）
+    seq.Add(0x3A, {Colmod(pixel_format_)});
 
     // 電源制御
-    Cmd(0xF0); Dat(0xC3);
-    Cmd(0xF0); Dat(0x96);
-    Cmd(0xB4); Dat(0x01);
-    Cmd(0xB7); Dat(0xC6);
-    Cmd(0xC0); Dat(0x80); Dat(0x45);
-    Cmd(0xC1); Dat(0x13);
-    Cmd(0xC2); Dat(0xA7);
-    Cmd(0xC5); Dat(0x0A);
+    seq.Add(0xF0, {0xC3})
+        .Add(0xF0, {0x96})
+        .Add(0xB4, {0x01})
+        .Add(0xB7, {0xC6})
+        .Add(0xC0, {0x80, 0x45})
+        .Add(0xC1, {0x13})
+        .Add(0xC2, {0xA7})
+        .Add(0xC5, {0x0A});
 
     // ガンマ補正等
-    Cmd(0xE8);
-    for (uint8_t v : std::array<uint8_t, 8>{0x40, 0x8A, 0x00, 0x00, 0x29, 0x19, 0xA5, 0x33})
-        Dat(v);
-    Cmd(0xE0);
-    for (uint8_t v : std::array<uint8_t, 14>{0xD0, 0x08, 0x0F, 0x06, 0x06, 0x33, 0x30, 0x33,
-                                              0x47, 0x17, 0x13, 0x13, 0x2B, 0x31})
-        Dat(v);
-    Cmd(0xE1);
-    for (uint8_t v : std::array<uint8_t, 14>{0xD0, 0x0A, 0x11, 0x0B, 0x09, 0x07, 0x2F, 0x33,
-                                              0x47, 0x38, 0x15, 0x16, 0x2C, 0x32})
-        Dat(v);
+    seq.Add(0xE8, {0x40, 0x8A, 0x00, 0x00, 0x29, 0x19, 0xA5, 0x33});
+    seq.Add(0xE0, {0xD0, 0x08, 0x0F, 0x06, 0x06, 0x33, 0x30, 0x33,
+                   0x47, 0x17, 0x13, 0x13, 0x2B, 0x31});
+    seq.Add(0xE1, {0xD0, 0x0A, 0x11, 0x0B, 0x09, 0x07, 0x2F, 0x33,
+                   0x47, 0x38, 0x15, 0x16, 0x2C, 0x32});
 
     // コマンド保護解除
-    Cmd(0xF0); Dat(0x3C);
-    Cmd(0xF0); Dat(0x69);
+    seq.Add(0xF0, {0x3C})
+        .Add(0xF0, {0x69});
+
+    // TE 出力ON（TEON。0x00 で垂直ブランキングのみを出力）
+    if (te_) seq.Add(0x35, {0x00});
 
     // 表示ON
-    Cmd(0x21);  // inversion on
-    Cmd(0x11);
+    seq.Add(0x21);  // inversion on
+    seq.Add(0x11);
+    Send(seq);
     usleep(100000);
-    Cmd(0x29);  // display on
+    Send(CommandSequence().Add(0x29));  // display on
 }
 
 }  // namespace driver
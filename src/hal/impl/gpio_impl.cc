@@ -71,6 +71,31 @@ bool GpioImpl::WaitForEvent(int timeout_sec) {
     return result > 0;
 }
 
+bool GpioImpl::WaitForEdge(std::chrono::microseconds timeout) {
+    // 溜まっているイベントは過去のエッジなので読み捨てる
+    gpiod_line_event ev;
+    timespec zero{0, 0};
+    while (true) {
+        int result = gpiod_line_event_wait(line_, &zero);
+        if (result < 0) {
+            throw std::runtime_error("gpiod_line_event_wait failed");
+        }
+        if (result == 0) break;
+        ReadEvent(ev);
+    }
+
+    const auto sec = std::chrono::duration_cast<std::chrono::seconds>(timeout);
+    const auto nsec = std::chrono::duration_cast<std::chrono::nanoseconds>(timeout - sec);
+    timespec ts{static_cast<time_t>(sec.count()), static_cast<long>(nsec.count())};
+    int result = gpiod_line_event_wait(line_, &ts);
+    if (result < 0) {
+        throw std::runtime_error("gpiod_line_event_wait failed");
+    }
+    if (result == 0) return false;
+    ReadEvent(ev);
+    return true;
+}
+
 void GpioImpl::ReadEvent(gpiod_line_event& ev) {
     if (gpiod_line_event_read(line_, &ev) < 0) {
         throw std::runtime_error("gpiod_line_event_read failed");
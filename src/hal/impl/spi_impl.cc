@@ -1,6 +1,7 @@
 #include "hal/impl/spi_impl.h"
 
 #include <fcntl.h>
+#include <fstream>
 #include <linux/spi/spidev.h>
 #include <stdexcept>
 #include <sys/ioctl.h>
@@ -8,7 +9,16 @@
 
 namespace hal {
 
-SpiImpl::SpiImpl(const char* dev, uint32_t speed_hz, uint8_t mode, uint8_t bits) : fd_(-1) {
+size_t SpiImpl::ReadSpidevBufsiz() {
+    constexpr size_t kDefaultBufsiz = 4096;
+    std::ifstream ifs("/sys/module/spidev/parameters/bufsiz");
+    size_t bufsiz = 0;
+    if (!(ifs >> bufsiz) || bufsiz == 0) return kDefaultBufsiz;
+    return bufsiz;
+}
+
+SpiImpl::SpiImpl(const char* dev, uint32_t speed_hz, uint8_t mode, uint8_t bits)
+    : fd_(-1), max_transfer_(ReadSpidevBufsiz()) {
     fd_ = ::open(dev, O_RDWR);
     if (fd_ < 0)
         throw std::runtime_error("open spidev failed");
@@ -21,7 +31,7 @@ SpiImpl::SpiImpl(const char* dev, uint32_t speed_hz, uint8_t mode, uint8_t bits)
         throw std::runtime_error("SPI set speed failed");
 }
 
-SpiImpl::SpiImpl(SpiImpl&& other) noexcept : fd_(other.fd_) {
+SpiImpl::SpiImpl(SpiImpl&& other) noexcept : fd_(other.fd_), max_transfer_(other.max_transfer_) {
     other.fd_ = -1;
 }
 
@@ -30,6 +40,7 @@ SpiImpl& SpiImpl::operator=(SpiImpl&& other) noexcept {
         if (fd_ >= 0)
             ::close(fd_);
         fd_ = other.fd_;
+        max_transfer_ = other.max_transfer_;
         other.fd_ = -1;
     }
     return *this;
@@ -124,17 +124,66 @@ namespace sensor{
         return gngga;
     }
 
+    namespace {
+        // UTC 時刻を0時からの秒にする（無効なら NaN）
+        double UtcSeconds(uint8_t hour, uint8_t minute, double second) {
+            if (hour >= 24 || minute >= 60 || !std::isfinite(second)) {
+                return std::numeric_limits<double>::quiet_NaN();
+            }
+            return hour * 3600.0 + minute * 60.0 + second;
+        }
+    }   // namespace
+
     void L76k::ProcessNmeaLine(const std::string& line) {
         if (line.rfind("$GNRMC", 0) == 0) {
-            std::lock_guard<std::mutex> lk(mtx_);
-            gnrmc_data_ = ParseGnrmc(line);
+            const GNRMC rmc = ParseGnrmc(line);
+            {
+                std::lock_guard<std::mutex> lk(mtx_);
+                gnrmc_data_ = rmc;
+            }
+            TrackEpoch(kEpochRmc, UtcSeconds(rmc.hour, rmc.minute, rmc.second));
         } else if (line.rfind("$GNGGA", 0) == 0) {
-            std::lock_guard<std::mutex> lk(mtx_);
-            gngga_data_ = ParseGngga(line);
+            const GNGGA gga = ParseGngga(line);
+            {
+                std::lock_guard<std::mutex> lk(mtx_);
+                gngga_data_ = gga;
+            }
+            TrackEpoch(kEpochGga, UtcSeconds(gga.hour, gga.minute, gga.second));
         } else if (line.rfind("$GNVTG", 0) == 0) {
-            std::lock_guard<std::mutex> lk(mtx_);
-            gnvtg_data_ = ParseGnvtg(line);
+            const GNVTG vtg = ParseGnvtg(line);
+            {
+                std::lock_guard<std::mutex> lk(mtx_);
+                gnvtg_data_ = vtg;
+            }
+            TrackEpoch(kEpochVtg, std::numeric_limits<double>::quiet_NaN());
+        }
+    }
+
+    void L76k::TrackEpoch(uint8_t sentence, double utc_sec) {
+        // 同じ種類の文が再び来た、または時刻が変わったら新しいエポックが始まっている
+        const bool utc_changed = std::isfinite(utc_sec) && std::isfinite(epoch_utc_) &&
+                                 utc_sec != epoch_utc_;
+        if ((epoch_seen_ & sentence) != 0 || utc_changed) {
+            // 文が欠けて揃わなかった前のエポックも、表示が止まらないよう通知する
+            if (epoch_seen_ != 0 && !epoch_notified_ && notifier_) {
+                notifier_->Notify(util::kUpdateGnss);
+            }
+            epoch_seen_ = 0;
+            epoch_notified_ = false;
+            epoch_utc_ = std::numeric_limits<double>::quiet_NaN();
         }
+        epoch_seen_ |= sentence;
+        if (std::isfinite(utc_sec)) epoch_utc_ = utc_sec;
+
+        // エポックの文が揃ったら1回だけ通知する（速度・位置・高度が同じエポックの値で揃う）
+        if (epoch_seen_ == kEpochComplete && !epoch_notified_) {
+            epoch_notified_ = true;
+            if (notifier_) notifier_->Notify(util::kUpdateGnss);
+        }
+    }
+
+    void L76k::SetNotifier(util::UpdateNotifier* notifier) {
+        notifier_ = notifier;
     }
 
     GnssSnapshot L76k::Snapshot() const {
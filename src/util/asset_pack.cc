@@ -0,0 +1,48 @@
+#include "util/asset_pack.h"
+
+#include <cstdio>
+#include <cstring>
+
+namespace util {
+
+AssetPack::AssetPack(const std::string& path) : file_(path) {
+    if (!file_.IsOpen()) return;
+    if (file_.Size() < sizeof(AssetPackHeader)) return;
+
+    AssetPackHeader header;
+    std::memcpy(&header, file_.Data(), sizeof(header));
+    if (std::memcmp(header.magic, kAssetPackMagic, sizeof(header.magic)) != 0 ||
+        header.version != kAssetPackVersion) {
+        std::fprintf(stderr, "Invalid asset pack: %s\n", path.c_str());
+        return;
+    }
+    const size_t table_end = sizeof(AssetPackHeader) + sizeof(AssetEntry) * header.count;
+    if (table_end > file_.Size()) return;
+
+    const AssetEntry* entries =
+        reinterpret_cast<const AssetEntry*>(file_.Data() + sizeof(AssetPackHeader));
+    for (uint32_t i = 0; i < header.count; ++i) {
+        if (entries[i].offset + entries[i].size > file_.Size()) {
+            std::fprintf(stderr, "Truncated asset pack: %s\n", path.c_str());
+            return;
+        }
+    }
+    entries_ = entries;
+    count_ = header.count;
+}
+
+bool AssetPack::Find(const std::string& name, Asset& out) const {
+    for (uint32_t i = 0; i < count_; ++i) {
+        const AssetEntry& e = entries_[i];
+        if (std::strncmp(e.name, name.c_str(), kAssetNameLen) != 0) continue;
+        out.type = e.type;
+        out.width = static_cast<int>(e.width);
+        out.height = static_cast<int>(e.height);
+        out.data = file_.Data() + e.offset;
+        out.size = static_cast<size_t>(e.size);
+        return true;
+    }
+    return false;
+}
+
+}  // namespace util
@@ -0,0 +1,156 @@
+#include "util/blend565.h"
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#elif defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace util {
+
+namespace {
+
+#if defined(__ARM_NEON)
+
+inline uint16x8_t Div255(uint16x8_t v) {
+    return vshrq_n_u16(vaddq_u16(vaddq_u16(v, vdupq_n_u16(1)), vshrq_n_u16(v, 8)), 8);
+}
+
+// 8画素を合成する（bg はホスト順RGB565、a は0〜255を16bitへ広げたもの）
+inline uint16x8_t Blend8(uint16x8_t bg, uint16x8_t a, uint16x8_t fr, uint16x8_t fgc,
+                         uint16x8_t fb) {
+    const uint16x8_t inv = vsubq_u16(vdupq_n_u16(255), a);
+    const uint16x8_t br = vshrq_n_u16(bg, 11);
+    const uint16x8_t bgc = vandq_u16(vshrq_n_u16(bg, 5), vdupq_n_u16(0x3F));
+    const uint16x8_t bb = vandq_u16(bg, vdupq_n_u16(0x1F));
+    const uint16x8_t r = Div255(vmlaq_u16(vmulq_u16(fr, a), br, inv));
+    const uint16x8_t g = Div255(vmlaq_u16(vmulq_u16(fgc, a), bgc, inv));
+    const uint16x8_t b = Div255(vmlaq_u16(vmulq_u16(fb, a), bb, inv));
+    return vorrq_u16(vorrq_u16(vshlq_n_u16(r, 11), vshlq_n_u16(g, 5)), b);
+}
+
+#elif defined(__AVX2__)
+
+inline __m256i Div255(__m256i v) {
+    return _mm256_srli_epi16(
+        _mm256_add_epi16(_mm256_add_epi16(v, _mm256_set1_epi16(1)), _mm256_srli_epi16(v, 8)), 8);
+}
+
+// 16画素を合成する
+inline __m256i Blend16(__m256i bg, __m256i a, __m256i fr, __m256i fgc, __m256i fb) {
+    const __m256i inv = _mm256_sub_epi16(_mm256_set1_epi16(255), a);
+    const __m256i br = _mm256_srli_epi16(bg, 11);
+    const __m256i bgc = _mm256_and_si256(_mm256_srli_epi16(bg, 5), _mm256_set1_epi16(0x3F));
+    const __m256i bb = _mm256_and_si256(bg, _mm256_set1_epi16(0x1F));
+    const __m256i r =
+        Div255(_mm256_add_epi16(_mm256_mullo_epi16(fr, a), _mm256_mullo_epi16(br, inv)));
+    const __m256i g =
+        Div255(_mm256_add_epi16(_mm256_mullo_epi16(fgc, a), _mm256_mullo_epi16(bgc, inv)));
+    const __m256i b =
+        Div255(_mm256_add_epi16(_mm256_mullo_epi16(fb, a), _mm256_mullo_epi16(bb, inv)));
+    return _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi16(r, 11), _mm256_slli_epi16(g, 5)),
+                           b);
+}
+
+inline __m256i LoadAlpha16(const uint8_t* p) {
+    return _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+}
+
+#elif defined(__SSE2__)
+
+inline __m128i Div255(__m128i v) {
+    return _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(v, _mm_set1_epi16(1)), _mm_srli_epi16(v, 8)),
+                          8);
+}
+
+// 8画素を合成する
+inline __m128i Blend8(__m128i bg, __m128i a, __m128i fr, __m128i fgc, __m128i fb) {
+    const __m128i inv = _mm_sub_epi16(_mm_set1_epi16(255), a);
+    const __m128i br = _mm_srli_epi16(bg, 11);
+    const __m128i bgc = _mm_and_si128(_mm_srli_epi16(bg, 5), _mm_set1_epi16(0x3F));
+    const __m128i bb = _mm_and_si128(bg, _mm_set1_epi16(0x1F));
+    const __m128i r = Div255(_mm_add_epi16(_mm_mullo_epi16(fr, a), _mm_mullo_epi16(br, inv)));
+    const __m128i g = Div255(_mm_add_epi16(_mm_mullo_epi16(fgc, a), _mm_mullo_epi16(bgc, inv)));
+    const __m128i b = Div255(_mm_add_epi16(_mm_mullo_epi16(fb, a), _mm_mullo_epi16(bb, inv)));
+    return _mm_or_si128(_mm_or_si128(_mm_slli_epi16(r, 11), _mm_slli_epi16(g, 5)), b);
+}
+
+inline __m128i LoadAlpha8(const uint8_t* p) {
+    return _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)),
+                             _mm_setzero_si128());
+}
+
+#endif
+
+}  // namespace
+
+void Blend565Span(const uint8_t* alpha, uint16_t fg, uint16_t bg, uint16_t* dst, size_t n) {
+    size_t i = 0;
+#if defined(__ARM_NEON)
+    const uint16x8_t fr = vdupq_n_u16(fg >> 11);
+    const uint16x8_t fgc = vdupq_n_u16((fg >> 5) & 0x3F);
+    const uint16x8_t fb = vdupq_n_u16(fg & 0x1F);
+    const uint16x8_t vbg = vdupq_n_u16(bg);
+    for (; i + 8 <= n; i += 8) {
+        vst1q_u16(dst + i, Blend8(vbg, vmovl_u8(vld1_u8(alpha + i)), fr, fgc, fb));
+    }
+#elif defined(__AVX2__)
+    const __m256i fr = _mm256_set1_epi16(static_cast<short>(fg >> 11));
+    const __m256i fgc = _mm256_set1_epi16(static_cast<short>((fg >> 5) & 0x3F));
+    const __m256i fb = _mm256_set1_epi16(static_cast<short>(fg & 0x1F));
+    const __m256i vbg = _mm256_set1_epi16(static_cast<short>(bg));
+    for (; i + 16 <= n; i += 16) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i),
+                            Blend16(vbg, LoadAlpha16(alpha + i), fr, fgc, fb));
+    }
+#elif defined(__SSE2__)
+    const __m128i fr = _mm_set1_epi16(static_cast<short>(fg >> 11));
+    const __m128i fgc = _mm_set1_epi16(static_cast<short>((fg >> 5) & 0x3F));
+    const __m128i fb = _mm_set1_epi16(static_cast<short>(fg & 0x1F));
+    const __m128i vbg = _mm_set1_epi16(static_cast<short>(bg));
+    for (; i + 8 <= n; i += 8) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+                         Blend8(vbg, LoadAlpha8(alpha + i), fr, fgc, fb));
+    }
+#endif
+    for (; i < n; ++i) {
+        dst[i] = Blend565(bg, fg, alpha[i]);
+    }
+}
+
+void Blend565Over(const uint8_t* alpha, uint16_t fg, const uint16_t* bg, uint16_t* dst, size_t n) {
+    size_t i = 0;
+#if defined(__ARM_NEON)
+    const uint16x8_t fr = vdupq_n_u16(fg >> 11);
+    const uint16x8_t fgc = vdupq_n_u16((fg >> 5) & 0x3F);
+    const uint16x8_t fb = vdupq_n_u16(fg & 0x1F);
+    for (; i + 8 <= n; i += 8) {
+        vst1q_u16(dst + i, Blend8(vld1q_u16(bg + i), vmovl_u8(vld1_u8(alpha + i)), fr, fgc, fb));
+    }
+#elif defined(__AVX2__)
+    const __m256i fr = _mm256_set1_epi16(static_cast<short>(fg >> 11));
+    const __m256i fgc = _mm256_set1_epi16(static_cast<short>((fg >> 5) & 0x3F));
+    const __m256i fb = _mm256_set1_epi16(static_cast<short>(fg & 0x1F));
+    for (; i + 16 <= n; i += 16) {
+        const __m256i vbg = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bg + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i),
+                            Blend16(vbg, LoadAlpha16(alpha + i), fr, fgc, fb));
+    }
+#elif defined(__SSE2__)
+    const __m128i fr = _mm_set1_epi16(static_cast<short>(fg >> 11));
+    const __m128i fgc = _mm_set1_epi16(static_cast<short>((fg >> 5) & 0x3F));
+    const __m128i fb = _mm_set1_epi16(static_cast<short>(fg & 0x1F));
+    for (; i + 8 <= n; i += 8) {
+        const __m128i vbg = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bg + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+                         Blend8(vbg, LoadAlpha8(alpha + i), fr, fgc, fb));
+    }
+#endif
+    for (; i < n; ++i) {
+        dst[i] = Blend565(bg[i], fg, alpha[i]);
+    }
+}
+
+}  // namespace util
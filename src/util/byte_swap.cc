@@ -0,0 +1,46 @@
+#include "util/byte_swap.h"
+
+#include <cstring>
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace util {
+
+void SwapBytes16(const uint16_t* src, uint16_t* dst, size_t n) {
+    size_t i = 0;
+#if defined(__ARM_NEON)
+    for (; i + 8 <= n; i += 8) {
+        uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(src + i));
+        vst1q_u8(reinterpret_cast<uint8_t*>(dst + i), vrev16q_u8(v));
+    }
+#elif defined(__SSE2__)
+    for (; i + 8 <= n; i += 8) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), v);
+    }
+#endif
+    for (; i < n; ++i) {
+        dst[i] = Swap16(src[i]);
+    }
+}
+
+void FillSwapped16(uint8_t* dst, uint16_t v, size_t n) {
+    if (n == 0) return;
+    dst[0] = static_cast<uint8_t>(v >> 8);
+    dst[1] = static_cast<uint8_t>(v & 0xFF);
+    // 既に埋めた領域を倍々でコピーして広げる
+    size_t filled = 2;
+    const size_t total = n * 2;
+    while (filled < total) {
+        const size_t chunk = (filled < total - filled) ? filled : total - filled;
+        std::memcpy(dst + filled, dst, chunk);
+        filled += chunk;
+    }
+}
+
+}  // namespace util
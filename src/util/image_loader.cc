@@ -0,0 +1,38 @@
+#include "util/image_loader.h"
+
+#include <cstdio>
+
+#include "third_party/stb_image.h"
+#include "util/worker_pool.h"
+
+namespace util {
+
+bool LoadImageRGB565(const std::string& path, int dst_w, int dst_h, std::vector<uint16_t>& out) {
+    ScaleOptions opt;
+    opt.filter = ScaleFilter::kBilinear;
+    opt.dither = true;
+    opt.pool = &WorkerPool::Shared();
+    return LoadImageRGB565(path, dst_w, dst_h, out, opt);
+}
+
+bool LoadImageRGB565(const std::string& path, int dst_w, int dst_h, std::vector<uint16_t>& out,
+                     const ScaleOptions& opt) {
+    int w, h, ch;
+    unsigned char* img = stbi_load(path.c_str(), &w, &h, &ch, 0);
+    if (!img) {
+        std::fprintf(stderr, "Failed to load image: %s\n", path.c_str());
+        return false;
+    }
+    if (ch < 3) {
+        stbi_image_free(img);
+        return false;
+    }
+
+    out.resize(static_cast<size_t>(dst_w) * dst_h);
+    ScaleToRGB565(img, w, h, ch, out.data(), dst_w, dst_h, dst_w, opt);
+
+    stbi_image_free(img);
+    return true;
+}
+
+}  // namespace util
@@ -0,0 +1,231 @@
+#include "util/image_scaler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "util/worker_pool.h"
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#elif defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace util {
+
+namespace {
+
+constexpr int kFixShift = 16;              // 座標テーブルの固定小数点（16.16）
+constexpr int64_t kFixHalf = 1 << (kFixShift - 1);
+constexpr int kMinBandRows = 16;           // 並列化時の1帯あたりの最小行数
+
+// 4x4 Bayer 配列（0〜15）
+constexpr uint8_t kBayer4[4][4] = {
+    { 0,  8,  2, 10},
+    {12,  4, 14,  6},
+    { 3, 11,  1,  9},
+    {15,  7, 13,  5},
+};
+
+/**
+ * @brief 片方の軸の参照元テーブル
+ * 
+ * 出力座標ごとに、参照元の2画素（最近傍では i0 のみ使用）と i1 側の重み（0〜256）を持つ。
+ */
+struct AxisTable {
+    std::vector<int> i0;
+    std::vector<int> i1;
+    std::vector<uint16_t> w1;
+};
+
+AxisTable BuildAxis(int dst_len, int src_len, int64_t origin, int64_t step, bool bilinear) {
+    AxisTable t;
+    t.i0.resize(dst_len);
+    if (bilinear) {
+        t.i1.resize(dst_len);
+        t.w1.resize(dst_len);
+    }
+    for (int d = 0; d < dst_len; ++d) {
+        // 出力画素中心に対応する参照元座標
+        const int64_t pos = origin + step * d + step / 2;
+        if (!bilinear) {
+            t.i0[d] = std::clamp(static_cast<int>(pos >> kFixShift), 0, src_len - 1);
+            continue;
+        }
+        // 双線形補間では参照元画素の中心（+0.5）を基準にする
+        const int64_t q = pos - kFixHalf;
+        const int64_t base = q >> kFixShift;  // 負数でも floor になる算術シフト
+        const int64_t rem = q - base * (int64_t{1} << kFixShift);  // 0 以上 1.0 未満
+        const int frac = static_cast<int>(rem >> (kFixShift - 8));
+        t.i0[d] = std::clamp(static_cast<int>(base), 0, src_len - 1);
+        t.i1[d] = std::clamp(static_cast<int>(base) + 1, 0, src_len - 1);
+        t.w1[d] = static_cast<uint16_t>(frac);
+    }
+    return t;
+}
+
+void AddDither(uint8_t* c, size_t n, const uint8_t pattern[4]) {
+    for (size_t x = 0; x < n; ++x) {
+        const int v = c[x] + pattern[x & 3];
+        c[x] = static_cast<uint8_t>(v > 255 ? 255 : v);
+    }
+}
+
+}  // namespace
+
+void PackRGB565(const uint8_t* r, const uint8_t* g, const uint8_t* b, uint16_t* dst, size_t n) {
+    size_t i = 0;
+#if defined(__ARM_NEON)
+    const uint8x16_t mask_rb = vdupq_n_u8(0xF8);
+    const uint8x16_t mask_g = vdupq_n_u8(0xFC);
+    for (; i + 16 <= n; i += 16) {
+        const uint8x16_t vr = vandq_u8(vld1q_u8(r + i), mask_rb);
+        const uint8x16_t vg = vandq_u8(vld1q_u8(g + i), mask_g);
+        const uint8x16_t vb = vshrq_n_u8(vld1q_u8(b + i), 3);
+        uint16x8_t lo = vshll_n_u8(vget_low_u8(vr), 8);
+        lo = vorrq_u16(lo, vshll_n_u8(vget_low_u8(vg), 3));
+        lo = vorrq_u16(lo, vmovl_u8(vget_low_u8(vb)));
+        uint16x8_t hi = vshll_n_u8(vget_high_u8(vr), 8);
+        hi = vorrq_u16(hi, vshll_n_u8(vget_high_u8(vg), 3));
+        hi = vorrq_u16(hi, vmovl_u8(vget_high_u8(vb)));
+        vst1q_u16(dst + i, lo);
+        vst1q_u16(dst + i + 8, hi);
+    }
+#elif defined(__AVX2__)
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i mask_rb = _mm256_set1_epi8(static_cast<char>(0xF8));
+    const __m256i mask_g = _mm256_set1_epi8(static_cast<char>(0xFC));
+    for (; i + 32 <= n; i += 32) {
+        // unpack はレーン内で動くため、先に64bit単位で並べ替えて出力順を保つ
+        __m256i vr = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(r + i));
+        __m256i vg = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(g + i));
+        __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        vr = _mm256_permute4x64_epi64(_mm256_and_si256(vr, mask_rb), 0xD8);
+        vg = _mm256_permute4x64_epi64(_mm256_and_si256(vg, mask_g), 0xD8);
+        vb = _mm256_permute4x64_epi64(vb, 0xD8);
+        // (0, r) のバイト対で r << 8 を作る
+        __m256i lo = _mm256_unpacklo_epi8(zero, vr);
+        lo = _mm256_or_si256(lo, _mm256_slli_epi16(_mm256_unpacklo_epi8(vg, zero), 3));
+        lo = _mm256_or_si256(lo, _mm256_srli_epi16(_mm256_unpacklo_epi8(vb, zero), 3));
+        __m256i hi = _mm256_unpackhi_epi8(zero, vr);
+        hi = _mm256_or_si256(hi, _mm256_slli_epi16(_mm256_unpackhi_epi8(vg, zero), 3));
+        hi = _mm256_or_si256(hi, _mm256_srli_epi16(_mm256_unpackhi_epi8(vb, zero), 3));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), lo);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i + 16), hi);
+    }
+#elif defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i mask_rb = _mm_set1_epi8(static_cast<char>(0xF8));
+    const __m128i mask_g = _mm_set1_epi8(static_cast<char>(0xFC));
+    for (; i + 16 <= n; i += 16) {
+        const __m128i vr = _mm_and_si128(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(r + i)), mask_rb);
+        const __m128i vg = _mm_and_si128(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(g + i)), mask_g);
+        const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        // (0, r) のバイト対で r << 8 を作る
+        __m128i lo = _mm_unpacklo_epi8(zero, vr);
+        lo = _mm_or_si128(lo, _mm_slli_epi16(_mm_unpacklo_epi8(vg, zero), 3));
+        lo = _mm_or_si128(lo, _mm_srli_epi16(_mm_unpacklo_epi8(vb, zero), 3));
+        __m128i hi = _mm_unpackhi_epi8(zero, vr);
+        hi = _mm_or_si128(hi, _mm_slli_epi16(_mm_unpackhi_epi8(vg, zero), 3));
+        hi = _mm_or_si128(hi, _mm_srli_epi16(_mm_unpackhi_epi8(vb, zero), 3));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), lo);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 8), hi);
+    }
+#endif
+    for (; i < n; ++i) {
+        dst[i] = static_cast<uint16_t>(((r[i] & 0xF8) << 8) | ((g[i] & 0xFC) << 3) | (b[i] >> 3));
+    }
+}
+
+void ScaleToRGB565(const uint8_t* src, int src_w, int src_h, int channels,
+                   uint16_t* dst, int dst_w, int dst_h, int dst_stride,
+                   const ScaleOptions& opt) {
+    if (!src || !dst || src_w <= 0 || src_h <= 0 || dst_w <= 0 || dst_h <= 0) return;
+
+    const bool bilinear = opt.filter == ScaleFilter::kBilinear;
+
+    // 倍率と切り取り開始位置だけを浮動小数点で求め、以降は整数演算のみ
+    const double scale = std::max(double(dst_w) / src_w, double(dst_h) / src_h);
+    const double one = double(int64_t{1} << kFixShift);
+    const int64_t step = std::llround(one / scale);
+    const int64_t ox = std::llround((src_w - dst_w / scale) * 0.5 * one);
+    const int64_t oy = std::llround((src_h - dst_h / scale) * 0.5 * one);
+
+    AxisTable xt = BuildAxis(dst_w, src_w, ox, step, bilinear);
+    const AxisTable yt = BuildAxis(dst_h, src_h, oy, step, bilinear);
+    // 列テーブルはバイトオフセットに直しておく
+    for (int& v : xt.i0) v *= channels;
+    for (int& v : xt.i1) v *= channels;
+
+    const size_t src_row_bytes = static_cast<size_t>(src_w) * channels;
+
+    auto scale_rows = [&](int y_begin, int y_end) {
+        std::vector<uint8_t> work(static_cast<size_t>(dst_w) * 3);
+        uint8_t* wr = work.data();
+        uint8_t* wg = wr + dst_w;
+        uint8_t* wb = wg + dst_w;
+
+        for (int y = y_begin; y < y_end; ++y) {
+            const uint8_t* row0 = src + yt.i0[y] * src_row_bytes;
+            if (!bilinear) {
+                for (int x = 0; x < dst_w; ++x) {
+                    const uint8_t* p = row0 + xt.i0[x];
+                    wr[x] = p[0];
+                    wg[x] = p[1];
+                    wb[x] = p[2];
+                }
+            } else {
+                const uint8_t* row1 = src + yt.i1[y] * src_row_bytes;
+                const int wy1 = yt.w1[y];
+                const int wy0 = 256 - wy1;
+                for (int x = 0; x < dst_w; ++x) {
+                    const int o0 = xt.i0[x];
+                    const int o1 = xt.i1[x];
+                    const int wx1 = xt.w1[x];
+                    const int wx0 = 256 - wx1;
+                    uint8_t* out[3] = {wr + x, wg + x, wb + x};
+                    for (int c = 0; c < 3; ++c) {
+                        const int top = row0[o0 + c] * wx0 + row0[o1 + c] * wx1;
+                        const int bot = row1[o0 + c] * wx0 + row1[o1 + c] * wx1;
+                        *out[c] = static_cast<uint8_t>((top * wy0 + bot * wy1 + (1 << 15)) >> 16);
+                    }
+                }
+            }
+
+            if (opt.dither) {
+                // 量子化幅（赤青8、緑4）に合わせて Bayer 閾値を加算してから切り捨てる
+                uint8_t rb[4], gg[4];
+                for (int i = 0; i < 4; ++i) {
+                    rb[i] = kBayer4[y & 3][i] >> 1;
+                    gg[i] = kBayer4[y & 3][i] >> 2;
+                }
+                AddDither(wr, dst_w, rb);
+                AddDither(wg, dst_w, gg);
+                AddDither(wb, dst_w, rb);
+            }
+
+            PackRGB565(wr, wg, wb, dst + static_cast<size_t>(y) * dst_stride, dst_w);
+        }
+    };
+
+    int bands = 1;
+    if (opt.pool) {
+        bands = std::min(opt.pool->Concurrency() * 2, (dst_h + kMinBandRows - 1) / kMinBandRows);
+    }
+    if (bands <= 1) {
+        scale_rows(0, dst_h);
+        return;
+    }
+    const int rows_per_band = (dst_h + bands - 1) / bands;
+    opt.pool->ParallelFor(bands, [&](int band) {
+        const int y0 = band * rows_per_band;
+        scale_rows(y0, std::min(dst_h, y0 + rows_per_band));
+    });
+}
+
+}  // namespace util
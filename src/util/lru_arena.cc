@@ -0,0 +1,94 @@
+#include "util/lru_arena.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace util {
+
+LruArena::LruArena(size_t budget_bytes) {
+    SetBudget(budget_bytes);
+}
+
+uint8_t* LruArena::Find(uint64_t key, size_t* size) {
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+        ++misses_;
+        return nullptr;
+    }
+    ++hits_;
+    lru_.splice(lru_.begin(), lru_, it->second.lru);
+    if (size) *size = it->second.size;
+    return buf_.get() + it->second.offset;
+}
+
+uint8_t* LruArena::Insert(uint64_t key, size_t size) {
+    auto old = entries_.find(key);
+    if (old != entries_.end()) Erase(old);
+
+    const size_t need = AlignUp(size);
+    if (need > budget_) return nullptr;
+    if (top_ + need > budget_) MakeRoom(need);
+
+    lru_.push_front(key);
+    entries_.emplace(key, Entry{top_, size, lru_.begin()});
+    uint8_t* p = buf_.get() + top_;
+    top_ += need;
+    used_ += need;
+    return p;
+}
+
+void LruArena::Clear() {
+    entries_.clear();
+    lru_.clear();
+    top_ = 0;
+    used_ = 0;
+}
+
+void LruArena::SetBudget(size_t budget_bytes) {
+    Clear();
+    budget_ = AlignUp(budget_bytes);
+    buf_.reset(budget_ > 0 ? new uint8_t[budget_] : nullptr);
+}
+
+LruArena::Stats LruArena::GetStats() const {
+    Stats s;
+    s.hits = hits_;
+    s.misses = misses_;
+    s.evictions = evictions_;
+    s.entries = entries_.size();
+    s.bytes_used = used_;
+    s.budget_bytes = budget_;
+    return s;
+}
+
+void LruArena::Erase(std::unordered_map<uint64_t, Entry>::iterator it) {
+    used_ -= AlignUp(it->second.size);
+    lru_.erase(it->second.lru);
+    entries_.erase(it);
+}
+
+void LruArena::MakeRoom(size_t need) {
+    // 毎回詰め直さずに済むよう、予算の3/4まで空けておく
+    const size_t target = std::max(budget_ - budget_ / 4, need);
+    while (!lru_.empty() && used_ + need > target) {
+        Erase(entries_.find(lru_.back()));
+        ++evictions_;
+    }
+
+    // 生存エントリをアドレス順に先頭へ詰める
+    std::vector<Entry*> live;
+    live.reserve(entries_.size());
+    for (auto& kv : entries_) live.push_back(&kv.second);
+    std::sort(live.begin(), live.end(),
+              [](const Entry* a, const Entry* b) { return a->offset < b->offset; });
+    size_t pos = 0;
+    for (Entry* e : live) {
+        if (e->offset != pos) std::memmove(buf_.get() + pos, buf_.get() + e->offset, e->size);
+        e->offset = pos;
+        pos += AlignUp(e->size);
+    }
+    top_ = pos;
+}
+
+}  // namespace util
@@ -0,0 +1,28 @@
+#include "util/update_notifier.h"
+
+namespace util {
+
+void UpdateNotifier::Notify(uint32_t events) {
+    {
+        std::lock_guard<std::mutex> lk(mtx_);
+        pending_ |= events;
+    }
+    cv_.notify_all();
+}
+
+uint32_t UpdateNotifier::WaitUntil(Clock::time_point deadline) {
+    std::unique_lock<std::mutex> lk(mtx_);
+    cv_.wait_until(lk, deadline, [this]{ return pending_ != 0; });
+    const uint32_t events = pending_;
+    pending_ = 0;
+    return events;
+}
+
+uint32_t UpdateNotifier::Take() {
+    std::lock_guard<std::mutex> lk(mtx_);
+    const uint32_t events = pending_;
+    pending_ = 0;
+    return events;
+}
+
+}  // namespace util
@@ -0,0 +1,99 @@
+#include "util/worker_pool.h"
+
+#include <algorithm>
+
+namespace util {
+
+WorkerPool::WorkerPool(unsigned workers) {
+    threads_.reserve(workers);
+    for (unsigned i = 0; i < workers; ++i) {
+        threads_.emplace_back([this]{ WorkerLoop(); });
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lk(mtx_);
+        running_ = false;
+    }
+    cv_.notify_all();
+    for (std::thread& t : threads_) {
+        if (t.joinable()) t.join();
+    }
+}
+
+WorkerPool& WorkerPool::Shared() {
+    static WorkerPool pool(std::max(1u, std::thread::hardware_concurrency()) - 1);
+    return pool;
+}
+
+void WorkerPool::ParallelFor(int count, const std::function<void(int)>& task) {
+    if (count <= 0) return;
+    std::lock_guard<std::mutex> call_lk(call_mtx_);
+    if (threads_.empty() || count == 1) {
+        for (int i = 0; i < count; ++i) task(i);
+        return;
+    }
+
+    uint32_t gen;
+    {
+        std::lock_guard<std::mutex> lk(mtx_);
+        task_ = &task;
+        count_ = count;
+        remaining_ = count;
+        ++generation_;
+        next_.store(static_cast<uint64_t>(generation_) << 32, std::memory_order_release);
+        gen = generation_;
+    }
+    cv_.notify_all();
+
+    RunTasks(task, count, gen);
+
+    std::unique_lock<std::mutex> lk(mtx_);
+    done_cv_.wait(lk, [this]{ return remaining_ == 0; });
+    task_ = nullptr;
+}
+
+void WorkerPool::RunTasks(const std::function<void(int)>& task, int count,
+                          uint32_t generation) {
+    int done = 0;
+    uint64_t cur = next_.load(std::memory_order_acquire);
+    while (true) {
+        // 世代が変わっていれば、その呼び出しは既に終わっている（task も無効）
+        if (static_cast<uint32_t>(cur >> 32) != generation) break;
+        const int i = static_cast<int>(cur & 0xFFFFFFFFu);
+        if (i >= count) break;
+        if (!next_.compare_exchange_weak(cur, cur + 1, std::memory_order_acq_rel,
+                                         std::memory_order_acquire)) {
+            continue;
+        }
+        task(i);
+        ++done;
+        cur = next_.load(std::memory_order_acquire);
+    }
+    if (done > 0) {
+        std::lock_guard<std::mutex> lk(mtx_);
+        remaining_ -= done;
+        if (remaining_ == 0) done_cv_.notify_all();
+    }
+}
+
+void WorkerPool::WorkerLoop() {
+    uint32_t seen = 0;
+    while (true) {
+        const std::function<void(int)>* task;
+        int count;
+        {
+            std::unique_lock<std::mutex> lk(mtx_);
+            cv_.wait(lk, [&]{ return !running_ || (task_ && generation_ != seen); });
+            if (!running_) return;
+            // ロックを外した後に次の呼び出しが始まっても、この世代の値で判定する
+            seen = generation_;
+            task = task_;
+            count = count_;
+        }
+        RunTasks(*task, count, seen);
+    }
+}
+
+}  // namespace util
@@ -0,0 +1,38 @@
+#ifndef CYCOM_TESTS_MOCKS_HAL_COUNTING_GPIO_H_
+#define CYCOM_TESTS_MOCKS_HAL_COUNTING_GPIO_H_
+
+#include <chrono>
+#include <cstdint>
+
+#include "hal/interface/i_gpio.h"
+
+namespace hal {
+
+/**
+ * @brief 出力の変化回数を数える GPIO のモック（エッジは発生しない）
+ *
+ * DC 線の切り替え回数など、ドライバの出力の計測に使う。
+ */
+class CountingGpio : public IGpio {
+public:
+    void Set(int value) override {
+        if (value != value_) ++toggles_;
+        value_ = value;
+    }
+    int Get() override { return value_; }
+    void RequestRisingEdge() override {}
+    void RequestFallingEdge() override {}
+    bool WaitForEvent(int /*timeout_sec*/) override { return false; }
+    bool WaitForEdge(std::chrono::microseconds /*timeout*/) override { return false; }
+
+    void Reset() { toggles_ = 0; }
+    uint64_t Toggles() const { return toggles_; }  // 出力が変化した回数
+
+private:
+    int value_ = 0;
+    uint64_t toggles_ = 0;
+};
+
+}  // namespace hal
+
+#endif  // CYCOM_TESTS_MOCKS_HAL_COUNTING_GPIO_H_
@@ -0,0 +1,62 @@
+#ifndef CYCOM_TESTS_MOCKS_HAL_COUNTING_SPI_H_
+#define CYCOM_TESTS_MOCKS_HAL_COUNTING_SPI_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#include "hal/interface/i_spi.h"
+
+namespace hal {
+
+/**
+ * @brief 送信を破棄し、書き込み回数とバイト数だけを数える SPI のモック
+ *
+ * ドライバが1回の操作で何回・何バイトの転送を行うかの計測に使う。
+ */
+class CountingSpi : public ISpi {
+public:
+    /**
+     * @param max_transfer MaxTransferSize() が返す値（spidev の bufsiz に相当）
+     */
+    explicit CountingSpi(size_t max_transfer = 4096) : max_transfer_(max_transfer) {}
+
+    void WriteBytes(const uint8_t* /*data*/, size_t len) override {
+        ++writes_;
+        bytes_ += len;
+        largest_write_ = std::max(largest_write_, len);
+    }
+
+    void ReadBytes(uint8_t* buffer, size_t len) override { std::fill(buffer, buffer + len, 0); }
+
+    void Transfer(const uint8_t* /*tx_data*/, uint8_t* rx_buffer, size_t len) override {
+        ++writes_;
+        bytes_ += len;
+        std::fill(rx_buffer, rx_buffer + len, 0);
+    }
+
+    size_t MaxTransferSize() const override { return max_transfer_; }
+
+    /**
+     * @brief 計数を0に戻す
+     */
+    void Reset() {
+        writes_ = 0;
+        bytes_ = 0;
+        largest_write_ = 0;
+    }
+
+    uint64_t Writes() const { return writes_; }        // 書き込み（ioctl）の回数
+    uint64_t Bytes() const { return bytes_; }          // 送信したバイト数
+    size_t LargestWrite() const { return largest_write_; }
+
+private:
+    size_t max_transfer_;
+    uint64_t writes_ = 0;
+    uint64_t bytes_ = 0;
+    size_t largest_write_ = 0;
+};
+
+}  // namespace hal
+
+#endif  // CYCOM_TESTS_MOCKS_HAL_COUNTING_SPI_H_
@@ -1,7 +1,14 @@
 #include "hal/impl/gpio_impl.h"
 
+#include <thread>
+
 namespace hal {
 
+namespace {
+// WaitForEdge() が返す擬似エッジの周期（LCD の TE 出力相当の約60Hz）
+constexpr std::chrono::microseconds kMockEdgePeriod{16667};
+}  // namespace
+
 // モック実装（テスト環境用）
 gpiod_chip* GpioImpl::OpenChipFlexible(const std::string& chip) {
     return reinterpret_cast<gpiod_chip*>(1);  // ダミーポインタ
@@ -35,6 +42,21 @@ bool GpioImpl::WaitForEvent(int timeout_sec) {
     return false;
 }
 
+bool GpioImpl::WaitForEdge(std::chrono::microseconds timeout) {
+    // モック: steady_clock の kMockEdgePeriod の倍数の時刻にエッジが発生したものとして扱う
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point now = Clock::now();
+    const auto since_epoch = std::chrono::duration_cast<std::chrono::microseconds>(
+        now.time_since_epoch());
+    const Clock::time_point next = now + (kMockEdgePeriod - since_epoch % kMockEdgePeriod);
+    if (next - now > timeout) {
+        std::this_thread::sleep_for(timeout);
+        return false;
+    }
+    std::this_thread::sleep_until(next);
+    return true;
+}
+
 void GpioImpl::ReadEvent(gpiod_line_event& ev) {
     // モック: ダミーイベント
     ev.event_type = 0;
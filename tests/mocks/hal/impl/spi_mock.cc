@@ -4,16 +4,22 @@ namespace hal {
 
 // モック実装（テスト環境用）
 SpiImpl::SpiImpl(const char* dev, uint32_t speed_hz, uint8_t mode, uint8_t bits)
-    : fd_(1) {  // ダミーfd
+    : fd_(1), max_transfer_(ReadSpidevBufsiz()) {  // ダミーfd
 }
 
-SpiImpl::SpiImpl(SpiImpl&& other) noexcept : fd_(other.fd_) {
+size_t SpiImpl::ReadSpidevBufsiz() {
+    // モック: spidevの既定値
+    return 4096;
+}
+
+SpiImpl::SpiImpl(SpiImpl&& other) noexcept : fd_(other.fd_), max_transfer_(other.max_transfer_) {
     other.fd_ = -1;
 }
 
 SpiImpl& SpiImpl::operator=(SpiImpl&& other) noexcept {
     if (this != &other) {
         fd_ = other.fd_;
+        max_transfer_ = other.max_transfer_;
         other.fd_ = -1;
     }
     return *this;
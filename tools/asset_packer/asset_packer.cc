@@ -0,0 +1,135 @@
+// アセットパック生成ツール（ビルド時に実行）
+//
+// 使い方: cycom_asset_pack <出力パス> <パネル幅> <パネル高さ> <入力ファイル>...
+//   .jpg / .jpeg / .png : パネル解像度へ拡大縮小し、パネル転送順RGB565として格納
+//   .ttf / .otf         : フォントファイルをそのまま格納
+//   その他              : バイナリとしてそのまま格納
+// アセット名は入力ファイル名（ディレクトリ部分を除く）になる。
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "util/asset_pack.h"
+#include "util/byte_swap.h"
+#include "util/image_loader.h"
+
+namespace {
+
+struct Input {
+    util::AssetEntry entry{};
+    std::vector<uint8_t> data;
+};
+
+std::string BaseName(const std::string& path) {
+    const size_t pos = path.find_last_of('/');
+    return pos == std::string::npos ? path : path.substr(pos + 1);
+}
+
+std::string LowerExt(const std::string& path) {
+    const size_t pos = path.find_last_of('.');
+    if (pos == std::string::npos) return "";
+    std::string ext = path.substr(pos + 1);
+    std::transform(ext.begin(), ext.end(), ext.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return ext;
+}
+
+bool LoadInput(const std::string& path, int panel_w, int panel_h, Input& in) {
+    const std::string name = BaseName(path);
+    if (name.size() >= util::kAssetNameLen) {
+        std::cerr << "asset name too long: " << name << "\n";
+        return false;
+    }
+    std::strncpy(in.entry.name, name.c_str(), util::kAssetNameLen - 1);
+
+    const std::string ext = LowerExt(path);
+    if (ext == "jpg" || ext == "jpeg" || ext == "png") {
+        std::vector<uint16_t> px;
+        if (!util::LoadImageRGB565(path, panel_w, panel_h, px)) return false;
+        util::SwapBytes16(px.data(), px.data(), px.size());
+        in.entry.type = util::AssetType::kImageRGB565Panel;
+        in.entry.width = static_cast<uint32_t>(panel_w);
+        in.entry.height = static_cast<uint32_t>(panel_h);
+        in.data.resize(px.size() * 2);
+        std::memcpy(in.data.data(), px.data(), in.data.size());
+        return true;
+    }
+
+    std::ifstream ifs(path, std::ios::binary);
+    if (!ifs.is_open()) {
+        std::cerr << "failed to open: " << path << "\n";
+        return false;
+    }
+    in.data.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+    in.entry.type = (ext == "ttf" || ext == "otf") ? util::AssetType::kFont
+                                                   : util::AssetType::kBlob;
+    return true;
+}
+
+size_t AlignUp(size_t v) {
+    return (v + util::kAssetAlign - 1) / util::kAssetAlign * util::kAssetAlign;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 5) {
+        std::cerr << "usage: " << argv[0] << " <output> <width> <height> <input>...\n";
+        return 1;
+    }
+    const std::string out_path = argv[1];
+    const int panel_w = std::atoi(argv[2]);
+    const int panel_h = std::atoi(argv[3]);
+    if (panel_w <= 0 || panel_h <= 0) {
+        std::cerr << "invalid panel size\n";
+        return 1;
+    }
+
+    std::vector<Input> inputs(argc - 4);
+    for (int i = 4; i < argc; ++i) {
+        if (!LoadInput(argv[i], panel_w, panel_h, inputs[i - 4])) return 1;
+    }
+
+    // オフセットを確定する
+    size_t offset = AlignUp(sizeof(util::AssetPackHeader) +
+                            sizeof(util::AssetEntry) * inputs.size());
+    for (Input& in : inputs) {
+        in.entry.offset = offset;
+        in.entry.size = in.data.size();
+        offset = AlignUp(offset + in.data.size());
+    }
+
+    std::ofstream ofs(out_path, std::ios::binary | std::ios::trunc);
+    if (!ofs.is_open()) {
+        std::cerr << "failed to create: " << out_path << "\n";
+        return 1;
+    }
+    util::AssetPackHeader header{};
+    std::memcpy(header.magic, util::kAssetPackMagic, sizeof(header.magic));
+    header.version = util::kAssetPackVersion;
+    header.count = static_cast<uint32_t>(inputs.size());
+    ofs.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (const Input& in : inputs) {
+        ofs.write(reinterpret_cast<const char*>(&in.entry), sizeof(in.entry));
+    }
+    for (const Input& in : inputs) {
+        const size_t pad = static_cast<size_t>(in.entry.offset) - static_cast<size_t>(ofs.tellp());
+        const std::vector<char> zeros(pad, 0);
+        ofs.write(zeros.data(), zeros.size());
+        ofs.write(reinterpret_cast<const char*>(in.data.data()), in.data.size());
+    }
+    if (!ofs) {
+        std::cerr << "write failed: " << out_path << "\n";
+        return 1;
+    }
+    std::cout << "asset pack: " << out_path << " (" << inputs.size() << " assets, "
+              << offset << " bytes)\n";
+    return 0;
+}
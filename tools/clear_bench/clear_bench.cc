@@ -0,0 +1,71 @@
+// ST7796::Clear() の転送計測ツール
+//
+// 使い方: cycom_clear_bench [繰り返し回数] [SPIクロック(Hz)]
+//   送信を数えるだけの SPI のモック（tests/mocks/hal/counting_spi.h）へ ST7796 を接続し、
+//   spidev の bufsiz とピクセル形式の組み合わせごとに Clear() を繰り返して、
+//   1回あたりの SPI 書き込み回数・バイト数・DC の切り替え回数・CPU 時間と、
+//   指定クロックでの転送時間の見積もりを表示する（既定: 200回、40 MHz）。
+//   色は毎回変えるため、塗りつぶし用バッファの展開も時間に含まれる。
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include "driver/impl/st7796.h"
+#include "hal/counting_gpio.h"
+#include "hal/counting_spi.h"
+
+namespace {
+
+const char* FormatName(driver::PixelFormat format) {
+    switch (format) {
+    case driver::PixelFormat::kRGB444: return "RGB444";
+    case driver::PixelFormat::kRGB666: return "RGB666";
+    case driver::PixelFormat::kRGB565:
+    default: return "RGB565";
+    }
+}
+
+void Run(size_t bufsiz, int iterations, double spi_hz) {
+    hal::CountingSpi spi(bufsiz);
+    hal::CountingGpio dc, rst, bl;
+    driver::ST7796 lcd(&spi, &dc, &rst, &bl);
+
+    for (driver::PixelFormat format : {driver::PixelFormat::kRGB565, driver::PixelFormat::kRGB444,
+                                       driver::PixelFormat::kRGB666}) {
+        lcd.SetPixelFormat(format);
+        spi.Reset();
+        dc.Reset();
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) lcd.Clear(i & 1 ? 0xFFFF : 0x001F);
+        const std::chrono::duration<double, std::micro> elapsed =
+            std::chrono::steady_clock::now() - start;
+
+        const double writes = static_cast<double>(spi.Writes()) / iterations;
+        const double bytes = static_cast<double>(spi.Bytes()) / iterations;
+        std::printf("  bufsiz %6zu  %-6s  %6.1f writes  %7.0f B  %4.1f DC toggles  "
+                    "%7.1f us CPU  %5.1f ms @ %.0f MHz  (largest write %zu B)\n",
+                    bufsiz, FormatName(format), writes, bytes,
+                    static_cast<double>(dc.Toggles()) / iterations, elapsed.count() / iterations,
+                    bytes * 8.0 / spi_hz * 1e3, spi_hz / 1e6, spi.LargestWrite());
+    }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const long iterations = argc > 1 ? std::strtol(argv[1], nullptr, 10) : 200;
+    const double spi_hz = argc > 2 ? std::strtod(argv[2], nullptr) : 40e6;
+    if (iterations <= 0 || spi_hz <= 0.0) {
+        std::fprintf(stderr, "usage: %s [iterations] [spi_hz]\n", argv[0]);
+        return 2;
+    }
+
+    std::printf("ST7796::Clear() x %ld (full screen, alternating colours)\n", iterations);
+    // spidev の既定値と、bufsiz を拡げた場合
+    for (size_t bufsiz : {size_t{4096}, size_t{65536}}) {
+        Run(bufsiz, static_cast<int>(iterations), spi_hz);
+    }
+    return 0;
+}
@@ -0,0 +1,224 @@
+// グリフアトラス生成ツール（ビルド時に実行）
+//
+// 使い方: cycom_font_atlas_gen <出力パス> <範囲> <サイズ> <フォント>...
+//   <範囲>   : コードポイント範囲のカンマ区切り（例: "0x20-0x7E,0xB0"）
+//   <サイズ> : ピクセルサイズのカンマ区切り（例: "28,48"）
+//   各フォント×サイズについて範囲内のグリフを FreeType でレンダリングし、
+//   1枚のアトラス画像へ詰めてグリフ表と合わせて出力する（形式は display/glyph_atlas.h）。
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "display/glyph_atlas.h"
+
+namespace {
+
+constexpr int kAtlasWidth = 512;  // アトラス画像の幅（これを超えるグリフは幅を広げる）
+
+struct Face {
+    ui::GlyphAtlasFace header{};
+    std::vector<ui::GlyphAtlasGlyph> glyphs;
+    std::vector<uint8_t> atlas;
+};
+
+std::vector<std::string> Split(const std::string& s) {
+    std::vector<std::string> out;
+    std::stringstream ss(s);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (!item.empty()) out.push_back(item);
+    }
+    return out;
+}
+
+bool ParseRanges(const std::string& s, std::vector<uint32_t>& cps) {
+    for (const std::string& item : Split(s)) {
+        const size_t dash = item.find('-');
+        char* end = nullptr;
+        const unsigned long lo = std::strtoul(item.c_str(), &end, 0);
+        unsigned long hi = lo;
+        if (dash != std::string::npos) hi = std::strtoul(item.c_str() + dash + 1, &end, 0);
+        if (hi < lo || hi > 0x10FFFF) return false;
+        for (unsigned long cp = lo; cp <= hi; ++cp) cps.push_back(static_cast<uint32_t>(cp));
+    }
+    std::sort(cps.begin(), cps.end());
+    cps.erase(std::unique(cps.begin(), cps.end()), cps.end());
+    return !cps.empty();
+}
+
+struct Bitmap {
+    ui::GlyphAtlasGlyph glyph{};
+    std::vector<uint8_t> alpha;  // 1行 = width バイト
+};
+
+bool BakeFace(FT_Face ft_face, int size, const std::vector<uint32_t>& cps, Face& out) {
+    if (FT_Set_Pixel_Sizes(ft_face, 0, size) != 0) return false;
+
+    std::vector<Bitmap> bitmaps;
+    for (uint32_t cp : cps) {
+        // フォントにない文字は収録しない（実行時に FreeType へフォールバックする）
+        if (FT_Get_Char_Index(ft_face, cp) == 0) continue;
+        if (FT_Load_Char(ft_face, cp, FT_LOAD_RENDER) != 0) continue;
+        const FT_GlyphSlot slot = ft_face->glyph;
+        const FT_Bitmap& bmp = slot->bitmap;
+        Bitmap b;
+        b.glyph.codepoint = cp;
+        b.glyph.index = slot->glyph_index;
+        b.glyph.width = static_cast<int16_t>(bmp.width);
+        b.glyph.height = static_cast<int16_t>(bmp.rows);
+        b.glyph.left = static_cast<int16_t>(slot->bitmap_left);
+        b.glyph.top = static_cast<int16_t>(slot->bitmap_top);
+        b.glyph.advance = static_cast<int16_t>(slot->advance.x >> 6);
+        b.alpha.resize(static_cast<size_t>(bmp.width) * bmp.rows);
+        for (unsigned y = 0; y < bmp.rows; ++y) {
+            std::memcpy(b.alpha.data() + static_cast<size_t>(y) * bmp.width,
+                        bmp.buffer + static_cast<long>(y) * bmp.pitch, bmp.width);
+        }
+        bitmaps.push_back(std::move(b));
+    }
+
+    // 高さ順に棚詰めする
+    int width = kAtlasWidth;
+    for (const Bitmap& b : bitmaps) width = std::max(width, static_cast<int>(b.glyph.width));
+    std::vector<size_t> order(bitmaps.size());
+    for (size_t i = 0; i < order.size(); ++i) order[i] = i;
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return bitmaps[a].glyph.height > bitmaps[b].glyph.height;
+    });
+    int x = 0, y = 0, shelf_h = 0;
+    for (size_t i : order) {
+        ui::GlyphAtlasGlyph& g = bitmaps[i].glyph;
+        if (x + g.width > width) {
+            x = 0;
+            y += shelf_h;
+            shelf_h = 0;
+        }
+        g.x = static_cast<uint16_t>(x);
+        g.y = static_cast<uint16_t>(y);
+        x += g.width;
+        shelf_h = std::max(shelf_h, static_cast<int>(g.height));
+    }
+    const int height = y + shelf_h;
+    if (height > 0xFFFF || width > 0xFFFF) return false;
+
+    out.atlas.assign(static_cast<size_t>(width) * height, 0);
+    for (const Bitmap& b : bitmaps) {
+        for (int row = 0; row < b.glyph.height; ++row) {
+            std::memcpy(out.atlas.data() + static_cast<size_t>(b.glyph.y + row) * width + b.glyph.x,
+                        b.alpha.data() + static_cast<size_t>(row) * b.glyph.width, b.glyph.width);
+        }
+        out.glyphs.push_back(b.glyph);  // cps が昇順なのでグリフ表も昇順
+    }
+
+    std::strncpy(out.header.family, ft_face->family_name ? ft_face->family_name : "",
+                 ui::kGlyphAtlasNameLen - 1);
+    std::strncpy(out.header.style, ft_face->style_name ? ft_face->style_name : "",
+                 ui::kGlyphAtlasNameLen - 1);
+    out.header.size_px = static_cast<uint32_t>(size);
+    out.header.glyph_count = static_cast<uint32_t>(out.glyphs.size());
+    out.header.atlas_width = static_cast<uint32_t>(width);
+    out.header.atlas_height = static_cast<uint32_t>(height);
+    return true;
+}
+
+size_t AlignUp(size_t v) {
+    return (v + ui::kGlyphAtlasAlign - 1) / ui::kGlyphAtlasAlign * ui::kGlyphAtlasAlign;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 5) {
+        std::cerr << "usage: " << argv[0] << " <output> <ranges> <sizes> <font>...\n";
+        return 1;
+    }
+    const std::string out_path = argv[1];
+    std::vector<uint32_t> cps;
+    if (!ParseRanges(argv[2], cps)) {
+        std::cerr << "invalid ranges: " << argv[2] << "\n";
+        return 1;
+    }
+    std::vector<int> sizes;
+    for (const std::string& s : Split(argv[3])) {
+        const int px = std::atoi(s.c_str());
+        if (px <= 0) {
+            std::cerr << "invalid size: " << s << "\n";
+            return 1;
+        }
+        sizes.push_back(px);
+    }
+
+    FT_Library ft;
+    if (FT_Init_FreeType(&ft) != 0) return 1;
+    std::vector<Face> faces;
+    for (int i = 4; i < argc; ++i) {
+        FT_Face ft_face;
+        if (FT_New_Face(ft, argv[i], 0, &ft_face) != 0) {
+            std::cerr << "failed to open font: " << argv[i] << "\n";
+            FT_Done_FreeType(ft);
+            return 1;
+        }
+        for (int px : sizes) {
+            Face f;
+            if (!BakeFace(ft_face, px, cps, f)) {
+                std::cerr << "failed to bake " << argv[i] << " at " << px << "px\n";
+                FT_Done_Face(ft_face);
+                FT_Done_FreeType(ft);
+                return 1;
+            }
+            faces.push_back(std::move(f));
+        }
+        FT_Done_Face(ft_face);
+    }
+    FT_Done_FreeType(ft);
+
+    // オフセットを確定する
+    size_t offset = AlignUp(sizeof(ui::GlyphAtlasHeader) + sizeof(ui::GlyphAtlasFace) * faces.size());
+    for (Face& f : faces) {
+        f.header.glyph_offset = offset;
+        offset = AlignUp(offset + sizeof(ui::GlyphAtlasGlyph) * f.glyphs.size());
+        f.header.atlas_offset = offset;
+        offset = AlignUp(offset + f.atlas.size());
+    }
+
+    std::ofstream ofs(out_path, std::ios::binary | std::ios::trunc);
+    if (!ofs.is_open()) {
+        std::cerr << "failed to create: " << out_path << "\n";
+        return 1;
+    }
+    auto pad_to = [&](uint64_t pos) {
+        const std::vector<char> zeros(static_cast<size_t>(pos - ofs.tellp()), 0);
+        ofs.write(zeros.data(), zeros.size());
+    };
+    ui::GlyphAtlasHeader header{};
+    std::memcpy(header.magic, ui::kGlyphAtlasMagic, sizeof(header.magic));
+    header.version = ui::kGlyphAtlasVersion;
+    header.face_count = static_cast<uint32_t>(faces.size());
+    ofs.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (const Face& f : faces) {
+        ofs.write(reinterpret_cast<const char*>(&f.header), sizeof(f.header));
+    }
+    for (const Face& f : faces) {
+        pad_to(f.header.glyph_offset);
+        ofs.write(reinterpret_cast<const char*>(f.glyphs.data()),
+                  sizeof(ui::GlyphAtlasGlyph) * f.glyphs.size());
+        pad_to(f.header.atlas_offset);
+        ofs.write(reinterpret_cast<const char*>(f.atlas.data()), f.atlas.size());
+    }
+    if (!ofs) {
+        std::cerr << "write failed: " << out_path << "\n";
+        return 1;
+    }
+    std::cout << "glyph atlas: " << out_path << " (" << faces.size() << " faces, " << offset
+              << " bytes)\n";
+    return 0;
+}
@@ -0,0 +1,145 @@
+// 組み込みフォント表生成ツール（ビルド時に実行）
+//
+// 使い方: cycom_font_bake <出力パス> <フォント> <文字列> <サイズ>...
+//   <文字列> に含まれる各文字を <サイズ> ごとに FreeType でレンダリングし、
+//   constexpr のαビットマップ表（C++ソース片）として出力する。
+//   出力は src/display/baked_font.cc から #include される。
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+// UTF-8 をコードポイント列へ分解する（不正なバイトは読み飛ばす）
+std::vector<uint32_t> DecodeUtf8(const std::string& s) {
+    std::vector<uint32_t> out;
+    for (size_t i = 0; i < s.size();) {
+        const unsigned char c0 = static_cast<unsigned char>(s[i]);
+        int len = c0 < 0x80 ? 1 : (c0 >> 5) == 0x6 ? 2 : (c0 >> 4) == 0xE ? 3
+                : (c0 >> 3) == 0x1E ? 4 : 0;
+        if (len == 0 || i + len > s.size()) {
+            ++i;
+            continue;
+        }
+        uint32_t cp = len == 1 ? c0 : (c0 & (0x7F >> len));
+        for (int k = 1; k < len; ++k) cp = (cp << 6) | (static_cast<unsigned char>(s[i + k]) & 0x3F);
+        out.push_back(cp);
+        i += len;
+    }
+    std::sort(out.begin(), out.end());
+    out.erase(std::unique(out.begin(), out.end()), out.end());
+    return out;
+}
+
+// C++ の文字列リテラルとして安全な形にする
+std::string Quote(const char* s) {
+    std::string out = "\"";
+    for (const char* p = s ? s : ""; *p; ++p) {
+        if (*p == '"' || *p == '\\') out += '\\';
+        out += *p;
+    }
+    return out + "\"";
+}
+
+bool BakeSize(FT_Face face, int size, const std::vector<uint32_t>& cps, std::ostream& os) {
+    if (FT_Set_Pixel_Sizes(face, 0, size) != 0) return false;
+
+    std::ostringstream table;
+    for (uint32_t cp : cps) {
+        if (FT_Load_Char(face, cp, FT_LOAD_RENDER) != 0) {
+            std::cerr << "skip U+" << std::hex << cp << std::dec << " at " << size << "px\n";
+            continue;
+        }
+        const FT_GlyphSlot slot = face->glyph;
+        const FT_Bitmap& bmp = slot->bitmap;
+        char name[32];
+        std::snprintf(name, sizeof(name), "kAlpha%d_%04X", size, static_cast<unsigned>(cp));
+
+        const bool empty = bmp.width == 0 || bmp.rows == 0;
+        if (!empty) {
+            // pitch の詰め物を除き、1行 = width バイトで出力する
+            os << "constexpr uint8_t " << name << "[] = {";
+            for (unsigned y = 0; y < bmp.rows; ++y) {
+                const unsigned char* row = bmp.buffer + static_cast<long>(y) * bmp.pitch;
+                os << "\n   ";
+                for (unsigned x = 0; x < bmp.width; ++x) os << ' ' << int(row[x]) << ',';
+            }
+            os << "\n};\n";
+        }
+        table << "    {0x" << std::hex << cp << std::dec << ", " << bmp.width << ", " << bmp.rows
+              << ", " << slot->bitmap_left << ", " << slot->bitmap_top << ", "
+              << (slot->advance.x >> 6) << ", " << slot->glyph_index << ", "
+              << (empty ? "nullptr" : name) << "},\n";
+    }
+    os << "constexpr BakedGlyph kGlyphs" << size << "[] = {\n" << table.str() << "};\n\n";
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 5) {
+        std::cerr << "usage: " << argv[0] << " <output> <font> <chars> <size>...\n";
+        return 1;
+    }
+    const std::string out_path = argv[1];
+    const std::vector<uint32_t> cps = DecodeUtf8(argv[3]);
+
+    std::vector<int> sizes;
+    for (int i = 4; i < argc; ++i) {
+        const int px = std::atoi(argv[i]);
+        if (px <= 0) {
+            std::cerr << "invalid size: " << argv[i] << "\n";
+            return 1;
+        }
+        if (std::find(sizes.begin(), sizes.end(), px) == sizes.end()) sizes.push_back(px);
+    }
+
+    FT_Library ft;
+    FT_Face face;
+    if (FT_Init_FreeType(&ft) != 0) return 1;
+    if (FT_New_Face(ft, argv[2], 0, &face) != 0) {
+        std::cerr << "failed to open font: " << argv[2] << "\n";
+        FT_Done_FreeType(ft);
+        return 1;
+    }
+
+    std::ostringstream os;
+    os << "// 自動生成ファイル（cycom_font_bake）。編集しないこと。\n"
+       << "// font: " << face->family_name << " " << face->style_name << "\n\n";
+    bool ok = true;
+    for (int px : sizes) ok = ok && BakeSize(face, px, cps, os);
+
+    os << "constexpr BakedFont kBakedFonts[] = {\n";
+    for (int px : sizes) {
+        os << "    {" << Quote(face->family_name) << ", " << Quote(face->style_name) << ", " << px
+           << ", kGlyphs" << px << ", sizeof(kGlyphs" << px << ") / sizeof(BakedGlyph)},\n";
+    }
+    os << "};\nconstexpr size_t kBakedFontCount = " << sizes.size() << ";\n";
+
+    FT_Done_Face(face);
+    FT_Done_FreeType(ft);
+    if (!ok) {
+        std::cerr << "failed to set pixel size\n";
+        return 1;
+    }
+
+    std::ofstream ofs(out_path, std::ios::trunc);
+    ofs << os.str();
+    if (!ofs) {
+        std::cerr << "write failed: " << out_path << "\n";
+        return 1;
+    }
+    std::cout << "baked font: " << out_path << " (" << cps.size() << " glyphs x " << sizes.size()
+              << " sizes)\n";
+    return 0;
+}
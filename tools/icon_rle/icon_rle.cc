@@ -0,0 +1,210 @@
+// アイコン変換ツール（ビルド時に実行）
+//
+// 使い方: cycom_icon_rle <出力パス> <PNG>...
+//   各画像を RGBA で読み込み、透明・不透明の単色・不透明の画素列・半透明の画素列のランに
+//   分けてランレングス圧縮し、constexpr の表（C++ソース片）として出力する。
+//   出力は src/display/rle_icon.cc から #include される。アイコン名は拡張子を除くファイル名。
+
+#include <cctype>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "display/rle_icon.h"
+#include "third_party/stb_image.h"
+
+namespace {
+
+// この範囲の不透明度は完全な透明・不透明として扱う（見た目は変わらずランが長くなる）
+constexpr int kTransparentMax = 3;
+constexpr int kOpaqueMin = 252;
+// 同じ色がこの画素数以上続けば単色のランにする
+constexpr int kMinSolidRun = 3;
+
+struct Encoded {
+    std::string name;
+    int width = 0;
+    int height = 0;
+    std::vector<uint8_t> ops;
+    std::vector<uint16_t> colors;
+    std::vector<uint8_t> alphas;
+    uint32_t opaque_px = 0;
+};
+
+std::string StemName(const std::string& path) {
+    const size_t slash = path.find_last_of('/');
+    std::string name = slash == std::string::npos ? path : path.substr(slash + 1);
+    const size_t dot = name.find_last_of('.');
+    if (dot != std::string::npos) name.resize(dot);
+    return name;
+}
+
+// C++ の識別子に使えない文字を '_' にする
+std::string Identifier(const std::string& name) {
+    std::string id = name;
+    for (char& c : id) {
+        if (!std::isalnum(static_cast<unsigned char>(c))) c = '_';
+    }
+    return id;
+}
+
+enum class PixelClass { kTransparent, kOpaque, kTranslucent };
+
+PixelClass Classify(const uint8_t* rgba) {
+    if (rgba[3] <= kTransparentMax) return PixelClass::kTransparent;
+    if (rgba[3] >= kOpaqueMin) return PixelClass::kOpaque;
+    return PixelClass::kTranslucent;
+}
+
+uint16_t ToRGB565(const uint8_t* rgba) {
+    return static_cast<uint16_t>(((rgba[0] & 0xF8) << 8) | ((rgba[1] & 0xFC) << 3) |
+                                 (rgba[2] >> 3));
+}
+
+void PushOp(Encoded& e, ui::RleOp op, int n) {
+    e.ops.push_back(static_cast<uint8_t>((static_cast<int>(op) << 6) | (n - 1)));
+}
+
+// 1行をランに分ける
+void EncodeRow(const uint8_t* row, int width, Encoded& e) {
+    auto px = [row](int x) { return row + static_cast<size_t>(x) * 4; };
+    auto solid_len = [&](int x) {
+        if (Classify(px(x)) != PixelClass::kOpaque) return 0;
+        const uint16_t c = ToRGB565(px(x));
+        int n = 1;
+        while (x + n < width && n < ui::RleIcon::kMaxRun &&
+               Classify(px(x + n)) == PixelClass::kOpaque && ToRGB565(px(x + n)) == c) {
+            ++n;
+        }
+        return n;
+    };
+
+    int x = 0;
+    while (x < width) {
+        const PixelClass cls = Classify(px(x));
+        int n = 1;
+        if (cls == PixelClass::kTransparent) {
+            while (x + n < width && n < ui::RleIcon::kMaxRun &&
+                   Classify(px(x + n)) == PixelClass::kTransparent) {
+                ++n;
+            }
+            PushOp(e, ui::RleOp::kSkip, n);
+        } else if (cls == PixelClass::kTranslucent) {
+            while (x + n < width && n < ui::RleIcon::kMaxRun &&
+                   Classify(px(x + n)) == PixelClass::kTranslucent) {
+                ++n;
+            }
+            PushOp(e, ui::RleOp::kAlpha, n);
+            for (int i = 0; i < n; ++i) {
+                e.colors.push_back(ToRGB565(px(x + i)));
+                e.alphas.push_back(px(x + i)[3]);
+            }
+        } else if ((n = solid_len(x)) >= kMinSolidRun) {
+            PushOp(e, ui::RleOp::kSolid, n);
+            e.colors.push_back(ToRGB565(px(x)));
+        } else {
+            // 単色のランが始まるところまでを画素列にする
+            n = 1;
+            while (x + n < width && n < ui::RleIcon::kMaxRun &&
+                   Classify(px(x + n)) == PixelClass::kOpaque && solid_len(x + n) < kMinSolidRun) {
+                ++n;
+            }
+            PushOp(e, ui::RleOp::kCopy, n);
+            for (int i = 0; i < n; ++i) e.colors.push_back(ToRGB565(px(x + i)));
+        }
+        if (cls != PixelClass::kTransparent) e.opaque_px += static_cast<uint32_t>(n);
+        x += n;
+    }
+}
+
+bool Encode(const std::string& path, Encoded& e) {
+    int w = 0, h = 0, ch = 0;
+    uint8_t* img = stbi_load(path.c_str(), &w, &h, &ch, 4);
+    if (!img) {
+        std::cerr << "failed to load " << path << ": " << stbi_failure_reason() << "\n";
+        return false;
+    }
+    if (w > INT16_MAX || h > INT16_MAX) {
+        std::cerr << "icon too large: " << path << "\n";
+        stbi_image_free(img);
+        return false;
+    }
+    e.name = StemName(path);
+    e.width = w;
+    e.height = h;
+    for (int y = 0; y < h; ++y) EncodeRow(img + static_cast<size_t>(y) * w * 4, w, e);
+    stbi_image_free(img);
+    return true;
+}
+
+template <typename T>
+void WriteArray(std::ostream& os, const char* type, const std::string& name,
+                const std::vector<T>& v) {
+    os << "constexpr " << type << " " << name << "[] = {";
+    for (size_t i = 0; i < v.size(); ++i) {
+        if (i % 16 == 0) os << "\n   ";
+        os << ' ' << static_cast<unsigned>(v[i]) << ',';
+    }
+    os << "\n};\n";
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::cerr << "usage: " << argv[0] << " <output> <png>...\n";
+        return 1;
+    }
+    const std::string out_path = argv[1];
+
+    std::vector<Encoded> icons;
+    for (int i = 2; i < argc; ++i) {
+        Encoded e;
+        if (!Encode(argv[i], e)) return 1;
+        icons.push_back(std::move(e));
+    }
+
+    std::ostringstream os;
+    os << "// 自動生成ファイル（cycom_icon_rle）。編集しないこと。\n\n";
+    size_t raw_bytes = 0, rle_bytes = 0;
+    for (const Encoded& e : icons) {
+        const std::string id = Identifier(e.name);
+        WriteArray(os, "uint8_t", "kOps_" + id, e.ops);
+        if (!e.colors.empty()) WriteArray(os, "uint16_t", "kColors_" + id, e.colors);
+        if (!e.alphas.empty()) WriteArray(os, "uint8_t", "kAlphas_" + id, e.alphas);
+        os << "\n";
+        raw_bytes += static_cast<size_t>(e.width) * e.height * 2;
+        rle_bytes += e.ops.size() + e.colors.size() * 2 + e.alphas.size();
+    }
+
+    if (icons.empty()) {
+        // 配列の要素数0は許されないため、アイコンがなければ表を空として定義する
+        os << "constexpr const RleIcon* kRleIcons = nullptr;\n";
+    } else {
+        os << "constexpr RleIcon kRleIcons[] = {\n";
+        for (const Encoded& e : icons) {
+            const std::string id = Identifier(e.name);
+            os << "    {\"" << e.name << "\", " << e.width << ", " << e.height << ", kOps_" << id
+               << ", " << e.ops.size() << ", "
+               << (e.colors.empty() ? "nullptr" : "kColors_" + id) << ", "
+               << (e.alphas.empty() ? "nullptr" : "kAlphas_" + id) << ", " << e.opaque_px
+               << "},\n";
+        }
+        os << "};\n";
+    }
+    os << "constexpr size_t kRleIconCount = " << icons.size() << ";\n";
+
+    std::ofstream ofs(out_path, std::ios::trunc);
+    ofs << os.str();
+    if (!ofs) {
+        std::cerr << "write failed: " << out_path << "\n";
+        return 1;
+    }
+    std::cout << "rle icons: " << out_path << " (" << icons.size() << " icons, " << rle_bytes
+              << " B, raw RGB565 " << raw_bytes << " B)\n";
+    return 0;
+}